@@ -29,6 +29,8 @@
 #include <iomanip>
 #include <string>
 #include <map>
+#include <vector>
+#include <cstring>
 #include <algorithm>
 #include <sys/stat.h>
 #include <ctime>
@@ -45,6 +47,12 @@ static const char *PARAM_O          = "-o";
 static const char *PARAM_V          = "-v";
 static const char *PARAM_INDEX      = "-index";
 static const char *PARAM_TOTAL      = "-t";
+static const char *PARAM_COMPRESS   = "-c";
+
+// Compressed blob layout, keep in sync with media_kernel_blob.h
+static const uint32_t BLOB_MAGIC        = 0x5A424B4D;  // MKBZ
+static const uint32_t BLOB_VERSION      = 1;
+static const uint32_t BLOB_HEADER_DWORDS = 4;           // magic, version, raw size, data size
 
 #ifdef LINUX_
 static const char *FILE_SEP         = "/";
@@ -134,6 +142,114 @@ std::string getFileName(const std::string &sFilePath)
     return sFilePath;
 }
 
+//-----------------------------------------------------------------------------
+// Compresses buffer into LZ4 block format
+//-----------------------------------------------------------------------------
+void lz4Compress(
+    const uint8_t           *pSrc,
+    uint32_t                 uiSize,
+    std::vector<uint8_t>    &oOut)
+{
+    const uint32_t uiHashBits     = 16;
+    const uint32_t uiMinMatch     = 4;
+    const uint32_t uiLastLiterals = 5;      // stream always ends with literals
+    const uint32_t uiMaxOffset    = 65535;
+
+    std::vector<int64_t> oTable(1 << uiHashBits, -1);
+    uint32_t uiAnchor = 0;
+    uint32_t uiPos    = 0;
+
+    auto hash = [&](uint32_t uiAt) {
+        uint32_t uiValue = 0;
+        memcpy(&uiValue, pSrc + uiAt, sizeof(uiValue));
+        return (uiValue * 2654435761u) >> (32 - uiHashBits);
+    };
+    auto writeLength = [&](uint32_t uiLength) {
+        while (uiLength >= 255)
+        {
+            oOut.push_back(255);
+            uiLength -= 255;
+        }
+        oOut.push_back((uint8_t)uiLength);
+    };
+
+    while (uiPos + uiMinMatch + uiLastLiterals <= uiSize)
+    {
+        uint32_t uiHash      = hash(uiPos);
+        int64_t  iCandidate  = oTable[uiHash];
+        oTable[uiHash]       = uiPos;
+
+        if (iCandidate < 0 ||
+            uiPos - iCandidate > uiMaxOffset ||
+            memcmp(pSrc + iCandidate, pSrc + uiPos, uiMinMatch) != 0)
+        {
+            uiPos++;
+            continue;
+        }
+
+        uint32_t uiMatch = uiMinMatch;
+        while (uiPos + uiMatch + uiLastLiterals < uiSize && pSrc[iCandidate + uiMatch] == pSrc[uiPos + uiMatch])
+        {
+            uiMatch++;
+        }
+
+        uint32_t uiLiterals = uiPos - uiAnchor;
+        uint32_t uiOffset   = uiPos - (uint32_t)iCandidate;
+        oOut.push_back((uint8_t)((std::min(uiLiterals, 15u) << 4) | std::min(uiMatch - uiMinMatch, 15u)));
+        if (uiLiterals >= 15)
+        {
+            writeLength(uiLiterals - 15);
+        }
+        oOut.insert(oOut.end(), pSrc + uiAnchor, pSrc + uiPos);
+        oOut.push_back((uint8_t)(uiOffset & 0xff));
+        oOut.push_back((uint8_t)(uiOffset >> 8));
+        if (uiMatch - uiMinMatch >= 15)
+        {
+            writeLength(uiMatch - uiMinMatch - 15);
+        }
+
+        // Index positions inside the match as well, which improves ratio of repeated kernel code.
+        for (uint32_t i = uiPos + 1; i < uiPos + uiMatch && i + uiMinMatch + uiLastLiterals <= uiSize; i++)
+        {
+            oTable[hash(i)] = i;
+        }
+
+        uiPos    += uiMatch;
+        uiAnchor = uiPos;
+    }
+
+    uint32_t uiLiterals = uiSize - uiAnchor;
+    oOut.push_back((uint8_t)(std::min(uiLiterals, 15u) << 4));
+    if (uiLiterals >= 15)
+    {
+        writeLength(uiLiterals - 15);
+    }
+    oOut.insert(oOut.end(), pSrc + uiAnchor, pSrc + uiSize);
+}
+
+//-----------------------------------------------------------------------------
+// Creates compressed blob, returns size in uint32_t
+//-----------------------------------------------------------------------------
+uint32_t createCompressedBlob(
+    const uint32_t          *pBuffer,
+    uint32_t                 uiSize,
+    std::vector<uint32_t>   &oBlob)
+{
+    std::vector<uint8_t> oStream;
+    lz4Compress(reinterpret_cast<const uint8_t *>(pBuffer), uiSize * sizeof(uint32_t), oStream);
+
+    oBlob.assign(BLOB_HEADER_DWORDS + (oStream.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+    oBlob[0] = BLOB_MAGIC;
+    oBlob[1] = BLOB_VERSION;
+    oBlob[2] = uiSize * sizeof(uint32_t);
+    oBlob[3] = (uint32_t)oStream.size();
+    memcpy(&oBlob[BLOB_HEADER_DWORDS], oStream.data(), oStream.size());
+
+    printf("Kernel compressed from %u to %zu bytes\n", oBlob[2], oBlob.size() * sizeof(uint32_t));
+
+    return (uint32_t)oBlob.size();
+}
+
 //-----------------------------------------------------------------------------
 // Writes the Header file
 //-----------------------------------------------------------------------------
@@ -231,7 +347,8 @@ int32_t writePartialSourceFile(
     {
         sPlatformName.erase(0, underPos + 1);
         std::map<std::string, std::string> nameMap = {
-            {"XE_HPG", "XE_HPG"}, {"XE_HPG_CMFCPATCH", "XE_HPG_CMFCPATCH"}
+            {"XE_HPG", "XE_HPG"}, {"XE_HPG_CMFCPATCH", "XE_HPG_CMFCPATCH"},
+            {"XE2_HPG", "XE2_HPG"}, {"XE2_HPG_CMFCPATCH", "XE2_HPG_CMFCPATCH"}
         };
 
         if (nameMap.find(sPlatformName) == nameMap.end())
@@ -365,7 +482,8 @@ int32_t writeSourceFile(
     {
         sPlatformName.erase(0, underPos + 1);
         std::map<std::string, std::string> nameMap = {
-            {"XE_HPG", "XE_HPG"}, {"XE_HPG_CMFCPATCH", "XE_HPG_CMFCPATCH"}
+            {"XE_HPG", "XE_HPG"}, {"XE_HPG_CMFCPATCH", "XE_HPG_CMFCPATCH"},
+            {"XE2_HPG", "XE2_HPG"}, {"XE2_HPG_CMFCPATCH", "XE2_HPG_CMFCPATCH"}
         };
 
         if (nameMap.find(sPlatformName) == nameMap.end())
@@ -432,7 +550,8 @@ int32_t createSourceFile(
     const std::string &sOutputDir,
     const std::string &sVar,
     const uint32_t &index,
-    const uint32_t &total)
+    const uint32_t &total,
+    bool bCompress)
 {
     struct stat     StatResult;
     int32_t         iStatus = -1;
@@ -514,7 +633,13 @@ int32_t createSourceFile(
         sOutputFile = appendPath(sOutputDir, sOutputFile);
 
         std::transform(sVarName.begin(), sVarName.end(), sVarName.begin(), ::toupper);
-        if (index == -1)
+        if (index == -1 && bCompress)
+        {
+            std::vector<uint32_t> oBlob;
+            uint32_t uiBlobSize = createCompressedBlob(pBuffer, uiIntSize, oBlob);
+            iStatus = writeSourceFile(oBlob.data(), uiBlobSize, sOutputFile, sVarName);
+        }
+        else if (index == -1)
         {
             iStatus = writeSourceFile(pBuffer, uiIntSize, sOutputFile, sVarName);
         }
@@ -662,12 +787,14 @@ void printUsage(const std::string &sProgram)
               << " [" << PARAM_V << " VarName]"
               << " [" << PARAM_INDEX << " Kernel Index]"
               << " [" << PARAM_TOTAL << " Kernel Total]"
+              << " [" << PARAM_COMPRESS << " Compress]"
               << std::endl
               << "    " << PARAM_I << " Path to Kernel binary input file (required)"             << std::endl
               << "    " << PARAM_O << " Path to Kernel binary output directory (optional)"       << std::endl
               << "    " << PARAM_V << " Variable Name on the generated source file (optional)"   << std::endl
               << "    " << PARAM_INDEX << " Variable kernel Index  (optional)"                   << std::endl
-              << "    " << PARAM_TOTAL << " Variable kernel total count (optional)"              << std::endl;
+              << "    " << PARAM_TOTAL << " Variable kernel total count (optional)"              << std::endl
+              << "    " << PARAM_COMPRESS << " 1 to emit compressed kernel blob, not for partial kernels (optional)" << std::endl;
 
 }
 
@@ -682,7 +809,8 @@ int32_t parseInput(
     std::string         &sOutput,
     std::string         &sVarName,
     uint32_t            &index,
-    uint32_t            &total)
+    uint32_t            &total,
+    bool                &bCompress)
 {
     int32_t iStatus = -1;
 
@@ -714,6 +842,10 @@ int32_t parseInput(
         {
             total = atoi(argv[i+1]) + 1;
         }
+        else if (0 == strcmp(PARAM_COMPRESS, argv[i]))
+        {
+            bCompress = atoi(argv[i+1]) != 0;
+        }
         else
         {
             std::cout << "Error: Invalid option " << argv[i] << std::endl;
@@ -772,8 +904,9 @@ int32_t main(int argc, char *argv[])
     std::string sVarName;
     uint32_t index=-1;
     uint32_t total=-1;
+    bool bCompress = false;
 
-    iStatus = parseInput(argc, argv, sProgram, sInputPath, sOutputDir, sVarName, index, total);
+    iStatus = parseInput(argc, argv, sProgram, sInputPath, sOutputDir, sVarName, index, total, bCompress);
     if (iStatus != 0)
     {
         goto finish;
@@ -781,7 +914,7 @@ int32_t main(int argc, char *argv[])
 
     iStatus = createHeaderFile(sInputPath, sOutputDir, sVarName);
 
-    iStatus = createSourceFile(sInputPath, sOutputDir, sVarName, index, total);
+    iStatus = createSourceFile(sInputPath, sOutputDir, sVarName, index, total, bCompress);
 
 finish:
     return iStatus;
@@ -0,0 +1,140 @@
+# Copyright (c) 2026, Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+# Reader of shared memory trace ring written by media driver when
+# GFX_MEDIA_TRACE_RING is set, see mos_trace_ring_specific.h for the layout.
+# The driver removes the file when the trace is closed, attach with --follow
+# while the process is running to keep reading until it exits.
+
+import os,sys,time,mmap,struct
+import argparse
+
+RING_MAGIC        = 0x52544D49  # IMTR
+RING_VERSION      = 1
+EVENT_MAGIC       = 0x494D5445  # IMTE
+FILE_HEADER_FMT   = '<6IQQ'
+SLOT_HEADER_FMT   = '<2I3Q'
+SLOT_HEADER_SIZE  = 64
+RECORD_HEADER_FMT = '<2IQ'
+RECORD_HEADER_SIZE = struct.calcsize(RECORD_HEADER_FMT)
+EVENT_TYPE        = {0: 'Info', 1: 'Start', 2: 'End', 3: 'Info2'}
+
+class TraceRing:
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR)
+        self.mm = mmap.mmap(self.fd, 0)
+        magic, version, self.pid, self.slot_count, self.slot_size, self.header_size, \
+            self.data_offset, _ = struct.unpack_from(FILE_HEADER_FMT, self.mm, 0)
+        if magic != RING_MAGIC:
+            raise ValueError('%s: bad magic 0x%x' % (path, magic))
+        if version != RING_VERSION:
+            raise ValueError('%s: unsupported version %d' % (path, version))
+
+    def close(self):
+        self.mm.close()
+        os.close(self.fd)
+
+    def global_drop(self):
+        return struct.unpack_from(FILE_HEADER_FMT, self.mm, 0)[7]
+
+    def slot(self, index):
+        return struct.unpack_from(SLOT_HEADER_FMT, self.mm, self.header_size + index * SLOT_HEADER_SIZE)
+
+    def set_read_pos(self, index, pos):
+        struct.pack_into('<Q', self.mm, self.header_size + index * SLOT_HEADER_SIZE + 16, pos)
+
+    def drain(self, index):
+        # Records in [readPos, writePos) are complete, consume them and advance readPos.
+        owner, _, write_pos, read_pos, _ = self.slot(index)
+        base = self.data_offset + index * self.slot_size
+        records = []
+        while read_pos < write_pos:
+            offset = base + (read_pos & (self.slot_size - 1))
+            size, tid, ts = struct.unpack_from(RECORD_HEADER_FMT, self.mm, offset)
+            if size < RECORD_HEADER_SIZE or size > self.slot_size:
+                print('slot %d: corrupted record at %d' % (index, read_pos), file=sys.stderr)
+                read_pos = write_pos
+                break
+            if tid != 0:
+                payload = self.mm[offset + RECORD_HEADER_SIZE: offset + size]
+                records.append((ts, tid, payload))
+            read_pos += size
+        self.set_read_pos(index, read_pos)
+        return records
+
+def decode_event(payload):
+    if len(payload) < 12:
+        return None
+    tag, header1, evt_type = struct.unpack_from('<3I', payload, 0)
+    if tag != EVENT_MAGIC:
+        return None
+    evt_id = header1 >> 16
+    size   = header1 & 0xffff
+    return evt_id, evt_type, payload[12: 12 + size]
+
+def print_records(records):
+    for ts, tid, payload in sorted(records):
+        event = decode_event(payload)
+        if event is None:
+            print('%d.%09d tid %d: unknown record %s' % (ts // 1000000000, ts % 1000000000, tid, payload.hex()))
+            continue
+        evt_id, evt_type, data = event
+        print('%d.%09d tid %d: event %d %s %s' % (ts // 1000000000, ts % 1000000000, tid, evt_id,
+              EVENT_TYPE.get(evt_type, str(evt_type)), data.hex()))
+
+def print_drops(ring):
+    total = ring.global_drop()
+    if total:
+        print('%d events dropped as no slot is free' % total)
+    for i in range(ring.slot_count):
+        owner, _, _, _, drop = ring.slot(i)
+        if drop:
+            print('slot %d (tid %d): %d events dropped as ring is full' % (i, owner, drop))
+            total += drop
+    return total
+
+def main(args):
+    path = args.file
+    if path is None:
+        path = '/dev/shm/GFX_MEDIA_TRACE_RING.%d' % args.pid
+    ring = TraceRing(path)
+    print('pid %d, %d slots of %d bytes' % (ring.pid, ring.slot_count, ring.slot_size))
+    try:
+        while True:
+            records = []
+            for i in range(ring.slot_count):
+                records.extend(ring.drain(i))
+            print_records(records)
+            if not args.follow:
+                break
+            time.sleep(args.interval)
+    except KeyboardInterrupt:
+        pass
+    print_drops(ring)
+    ring.close()
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Read media driver shared memory trace ring')
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument('-p', '--pid', type=int, help='process id of traced application')
+    group.add_argument('-f', '--file', help='path of trace ring file')
+    parser.add_argument('--follow', action='store_true', help='keep reading until interrupted')
+    parser.add_argument('--interval', type=float, default=0.1, help='poll interval in seconds in follow mode')
+    main(parser.parse_args())
@@ -0,0 +1,114 @@
+# Copyright (c) 2026, Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+# Writer of trace control data /dev/shm/GFX_MEDIA_TRACE, which media driver
+# maps on init and reads on every trace point, so changes take effect in
+# running processes without restart. See MtControlData in mos_os_trace_event.h.
+
+import os,sys,mmap,struct
+import argparse
+
+CONTROL_PATH         = '/dev/shm/GFX_MEDIA_TRACE'
+CONTROL_SIZE         = 4096
+ENABLE_OFFSET        = 0
+LEVEL_OFFSET         = 4
+FILTER_OFFSET        = 8
+EVENT_DISABLE_OFFSET = 512 + 2080  # MtControlData::setting.eventDisable
+EVENT_DISABLE_BITS   = 16 * 64
+
+def parse_ids(values):
+    ids = []
+    for v in values:
+        for item in v.split(','):
+            if '-' in item:
+                lo, hi = item.split('-')
+                ids.extend(range(int(lo, 0), int(hi, 0) + 1))
+            elif item:
+                ids.append(int(item, 0))
+    for i in ids:
+        if i < 0 or i >= EVENT_DISABLE_BITS:
+            raise ValueError('event id %d out of range' % i)
+    return ids
+
+def open_control(path):
+    fd = os.open(path, os.O_RDWR | os.O_CREAT, 0o644)
+    if os.fstat(fd).st_size < CONTROL_SIZE:
+        os.ftruncate(fd, CONTROL_SIZE)
+    return fd, mmap.mmap(fd, CONTROL_SIZE)
+
+def set_event_bits(mm, ids, disable):
+    for i in ids:
+        offset = EVENT_DISABLE_OFFSET + (i // 64) * 8
+        bits = struct.unpack_from('<Q', mm, offset)[0]
+        bits = bits | (1 << (i % 64)) if disable else bits & ~(1 << (i % 64))
+        struct.pack_into('<Q', mm, offset, bits)
+
+def format_ids(ids):
+    ranges = []
+    for i in ids:
+        if ranges and ranges[-1][1] == i - 1:
+            ranges[-1][1] = i
+        else:
+            ranges.append([i, i])
+    return ','.join('%d' % lo if lo == hi else '%d-%d' % (lo, hi) for lo, hi in ranges)
+
+def show(mm):
+    enable, level = struct.unpack_from('<IB', mm, ENABLE_OFFSET)
+    keys = struct.unpack_from('<Q', mm, FILTER_OFFSET)[0]
+    disabled = []
+    for w in range(EVENT_DISABLE_BITS // 64):
+        bits = struct.unpack_from('<Q', mm, EVENT_DISABLE_OFFSET + w * 8)[0]
+        disabled.extend(w * 64 + b for b in range(64) if bits & (1 << b))
+    print('enable %d level 0x%x keys 0x%016x' % (enable, level, keys))
+    print('disabled events: %s' % (format_ids(disabled) if disabled else 'none'))
+
+def main():
+    parser = argparse.ArgumentParser(description='Update media driver trace control data')
+    parser.add_argument('-p', '--path', default=CONTROL_PATH)
+    parser.add_argument('-e', '--enable', type=int, choices=[0, 1], help='global trace enable')
+    parser.add_argument('-k', '--keys', type=lambda x: int(x, 0), help='keyword filter bitmask')
+    parser.add_argument('-l', '--level', type=lambda x: int(x, 0), help='packed event/data/log level byte')
+    parser.add_argument('-d', '--disable', nargs='+', default=[], help='event ids to disable, e.g. 3,5-9')
+    parser.add_argument('-a', '--allow', nargs='+', default=[], help='event ids to enable again')
+    parser.add_argument('-o', '--only', nargs='+', default=[], help='enable only these event ids')
+    args = parser.parse_args()
+
+    fd, mm = open_control(args.path)
+    try:
+        if args.only:
+            only = set(parse_ids(args.only))
+            set_event_bits(mm, [i for i in range(EVENT_DISABLE_BITS) if i not in only], True)
+            set_event_bits(mm, only, False)
+        set_event_bits(mm, parse_ids(args.disable), True)
+        set_event_bits(mm, parse_ids(args.allow), False)
+        if args.keys is not None:
+            struct.pack_into('<Q', mm, FILTER_OFFSET, args.keys)
+        if args.level is not None:
+            struct.pack_into('<B', mm, LEVEL_OFFSET, args.level)
+        # Enable is written last, so driver never sees enabled trace with stale filters.
+        if args.enable is not None:
+            struct.pack_into('<I', mm, ENABLE_OFFSET, args.enable)
+        show(mm)
+    finally:
+        mm.close()
+        os.close(fd)
+
+if __name__ == '__main__':
+    main()
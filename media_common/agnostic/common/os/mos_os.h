@@ -1279,6 +1279,10 @@ typedef struct _MOS_INTERFACE
     MOS_STATUS(*pfnSkipResourceSync)(
         PMOS_RESOURCE               pOsResource);
 
+    bool (*pfnIsResourceBusy)(
+        PMOS_INTERFACE              pOsInterface,
+        PMOS_RESOURCE               pOsResource);
+
     MOS_STATUS(*pfnSetObjectCapture)(
         PMOS_RESOURCE               pOsResource);
 
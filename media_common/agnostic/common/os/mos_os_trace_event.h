@@ -147,7 +147,11 @@ struct MtSetting
         char filePath[1024];
     } hwcmdParser;
 
-    uint8_t rsv[1504];
+    // 1 bit per MEDIA_EVENT id, bit set disables the event. Zero filled
+    // control data keeps all events enabled, as before this field existed.
+    uint64_t eventDisable[16];
+
+    uint8_t rsv[1376];
 };
 
 // 4KB in total
@@ -406,7 +410,12 @@ typedef enum _MEDIA_EVENT
     EVENT_HWS_NATIVE_FENCE_CMD_FLUSH,              //! event for HWS sync cmd flush
     EVENT_HWS_NATIVE_FENCE_ADD_TO_ARRAY_CMD,       //! event for Hws Native Fence Add To Array Cmd
     EVENT_HWS_NATIVE_FENCE_ADD_TO_QUEUE_API,       //! event for Hws Native Fence Add To Queue Api
-    EVENT_HWS_NATIVE_FENCE_12_WAIT                 //! event for Hws Native Fence 12 Wait
+    EVENT_HWS_NATIVE_FENCE_12_WAIT,                //! event for Hws Native Fence 12 Wait
+    EVENT_PIPE_PACKET_CREATE,                      //! event for pipeline on-demand packet creation
+    EVENT_DDI_INIT_PHASE,                          //! event for DDI initialization phase timing
+    EVENT_VP_PIPE_STAGE_TIMING,                    //! event for VP single pipe stage timing
+    EVENT_VP_FRAME_ARENA,                          //! event for VP frame arena allocations of one frame
+    EVENT_MOS_BO_MAP_STATS                         //! event for CPU map statistics of a bufmgr
 } MEDIA_EVENT;
 
 typedef enum _MEDIA_EVENT_TYPE
@@ -482,6 +491,37 @@ private:
     size_t          m_maxKeyNum;
 };
 
+class MtEventFilter
+{
+public:
+    MtEventFilter(const uint64_t *disable = nullptr, size_t disableNum = 0) : m_disable(disable), m_maxId(disableNum * N) {}
+
+    ~MtEventFilter()
+    {
+        Reset();
+    }
+
+    //!
+    //! \brief  Check if event id is enabled, ids out of bitmap range are always enabled
+    //!
+    bool operator()(uint16_t id) const
+    {
+        return !(m_disable && id < m_maxId && (m_disable[id / N] & (1ULL << (id % N))));
+    }
+
+    void Reset()
+    {
+        m_disable = nullptr;
+        m_maxId   = 0;
+    }
+
+private:
+    static constexpr size_t N = sizeof(uint64_t) << 3;
+
+    const uint64_t *m_disable;
+    size_t          m_maxId;
+};
+
 class MtLevel
 {
 public:
@@ -450,6 +450,8 @@
 #define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_BUFFER_SIZE_KEY     "Perf Profiler Buffer Size"
 #define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_MUL_PROC_SINGLE_BIN "Perf Profiler Multi Process Single Binary"
 #define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_PARALLEL_EXEC       "Perf Profiler Parallel Execution Support"
+#define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_LATENCY_ENABLE     "Perf Profiler Latency Enable"
+#define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_LATENCY_EXPORT_MS  "Perf Profiler Latency Export Interval"
 
 #define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_KEY_1      "Perf Profiler Register 1"
 #define __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_KEY_2      "Perf Profiler Register 2"
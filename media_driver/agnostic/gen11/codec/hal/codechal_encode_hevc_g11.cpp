@@ -1701,7 +1701,7 @@ MOS_STATUS CodechalEncHevcStateG11::GetStatusReport(
         uint32_t offset = m_tileParams[i].BitstreamByteOffset * CODECHAL_CACHELINE_SIZE;
         uint32_t len = tileStatusReport[i].Length;
 
-        MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+        MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
         bufPtr += len;
     }
 
@@ -1842,7 +1842,7 @@ MOS_STATUS CodechalVdencVp9StateG11::GetStatusReport(
             return eStatus;
         }
 
-        MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+        MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
         bufPtr += len;
     }
 
@@ -2019,7 +2019,7 @@ MOS_STATUS CodechalEncHevcStateG12::GetStatusReport(
         uint32_t offset = m_tileParams[i].BitstreamByteOffset * CODECHAL_CACHELINE_SIZE;
         uint32_t len    = tileStatusReport[i].Length;
 
-        MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+        MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
         bufPtr += len;
     }
 
@@ -2069,7 +2069,7 @@ MOS_STATUS CodechalVdencHevcStateG12::GetStatusReport(
             uint32_t offset = tileParams[i].BitstreamByteOffset * CODECHAL_CACHELINE_SIZE;
             uint32_t len = tileStatusReport[i].Length;
 
-            MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+            MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
             bufPtr += len;
         }
 
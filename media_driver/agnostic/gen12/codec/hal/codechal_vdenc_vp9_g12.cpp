@@ -2182,7 +2182,7 @@ MOS_STATUS CodechalVdencVp9StateG12::GetStatusReport(
             return eStatus;
         }
 
-        MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+        MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
         bufPtr += len;
     }
 
@@ -5884,6 +5884,30 @@ finish:
     return eStatus;
 }
 
+//!
+//! \brief    Checks if GPU still has work pending on the resource
+//! \details  Does not wait, only queries the state of the BO
+//! \param    PMOS_INTERFACE pOsInterface
+//!           [in] Pointer to OS Interface
+//! \param    PMOS_RESOURCE pOsResource
+//!           [in] Pointer to OS Resource
+//! \return   bool
+//!           Return true if the resource is still in use by GPU
+//!
+bool Mos_Specific_IsResourceBusy(
+    PMOS_INTERFACE              pOsInterface,
+    PMOS_RESOURCE               pOsResource)
+{
+    MOS_UNUSED(pOsInterface);
+
+    if (pOsResource == nullptr || pOsResource->bo == nullptr)
+    {
+        return false;
+    }
+
+    return mos_bo_busy(pOsResource->bo) != 0;
+}
+
 //!
 //! \brief    Gets the HW rendering flags
 //! \details  Gets the HW rendering flags
@@ -7271,6 +7295,7 @@ MOS_STATUS Mos_Specific_InitInterface(
     pOsInterface->pfnCachePolicyGetMemoryObject             = Mos_Specific_CachePolicyGetMemoryObject;
     pOsInterface->pfnCachePolicyGetL1Config                 = Mos_Specific_CachePolicyGetL1Config;
     pOsInterface->pfnSkipResourceSync                       = Mos_Specific_SkipResourceSync;
+    pOsInterface->pfnIsResourceBusy                         = Mos_Specific_IsResourceBusy;
     pOsInterface->pfnIsGPUHung                              = Mos_Specific_IsGPUHung;
     pOsInterface->pfnGetAuxTableBaseAddr                    = Mos_Specific_GetAuxTableBaseAddr;
     pOsInterface->pfnSetSliceCount                          = Mos_Specific_SetSliceCount;
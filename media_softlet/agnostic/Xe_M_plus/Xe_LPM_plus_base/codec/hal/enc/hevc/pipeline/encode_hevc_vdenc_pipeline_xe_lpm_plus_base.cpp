@@ -76,21 +76,14 @@ MOS_STATUS HevcVdencPipelineXe_Lpm_Plus_Base::Init(void *settings)
         }
     }
 
-    HucLaInitPkt *laInitpkt = MOS_New(HucLaInitPkt, this, task, m_hwInterface);
-    ENCODE_CHK_STATUS_RETURN(RegisterPacket(HucLaInit, laInitpkt));
-    ENCODE_CHK_STATUS_RETURN(laInitpkt->Init());
+    // Lookahead and BRC packets are only needed by some rate control modes, create them on first activation.
+    RegisterPacket(HucLaInit, [=]() -> MediaPacket * { return MOS_New(HucLaInitPkt, this, task, m_hwInterface); });
 
-    HucLaUpdatePkt *laUpdatepkt = MOS_New(HucLaUpdatePkt, this, task, m_hwInterface);
-    ENCODE_CHK_STATUS_RETURN(RegisterPacket(HucLaUpdate, laUpdatepkt));
-    ENCODE_CHK_STATUS_RETURN(laUpdatepkt->Init());
+    RegisterPacket(HucLaUpdate, [=]() -> MediaPacket * { return MOS_New(HucLaUpdatePkt, this, task, m_hwInterface); });
 
-    HucBrcInitPkt *brcInitpkt = MOS_New(HucBrcInitPkt, this, task, m_hwInterface);
-    ENCODE_CHK_STATUS_RETURN(RegisterPacket(HucBrcInit, brcInitpkt));
-    ENCODE_CHK_STATUS_RETURN(brcInitpkt->Init());
+    RegisterPacket(HucBrcInit, [=]() -> MediaPacket * { return MOS_New(HucBrcInitPkt, this, task, m_hwInterface); });
 
-    HucBrcUpdatePkt *brcUpdatepkt = MOS_New(HucBrcUpdatePkt, this, task, m_hwInterface);
-    ENCODE_CHK_STATUS_RETURN(RegisterPacket(HucBrcUpdate, brcUpdatepkt));
-    ENCODE_CHK_STATUS_RETURN(brcUpdatepkt->Init());
+    RegisterPacket(HucBrcUpdate, [=]() -> MediaPacket * { return MOS_New(HucBrcUpdatePkt, this, task, m_hwInterface); });
 
     HevcVdencPkt *hevcVdencpkt = MOS_New(HevcVdencPkt, this, task, m_hwInterface);
     ENCODE_CHK_STATUS_RETURN(RegisterPacket(hevcVdencPacket, hevcVdencpkt));
@@ -58,7 +58,7 @@ namespace decode
         }
 
         Av1RefAssociatedBufs *bufs = MOS_New(Av1RefAssociatedBufs);
-        bufs->mvBuf = m_allocator->AllocateBuffer(
+        bufs->mvBuf = m_allocator->AllocatePooledBuffer(
             avpBufSizeParam.bufferSize, "MvTemporalBuffer", resourceInternalReadWriteCache, notLockableVideoMem);
 
         if (m_avpItf->GetAvpBufSize(mhw::vdbox::avp::segmentIdBuffer,
@@ -66,7 +66,7 @@ namespace decode
         {
             DECODE_ASSERTMESSAGE( "Failed to get SegmentIdBuffer size.");
         }
-        bufs->segIdWriteBuf.buffer = m_allocator->AllocateBuffer(
+        bufs->segIdWriteBuf.buffer = m_allocator->AllocatePooledBuffer(
             avpBufSizeParam.bufferSize, "SegmentIdWriteBuffer", resourceInternalReadWriteCache, notLockableVideoMem);
 
         bufs->bwdAdaptCdfBuf.buffer = m_allocator->AllocateBuffer(MOS_ALIGN_CEIL(m_basicFeature->m_cdfMaxNumBytes,
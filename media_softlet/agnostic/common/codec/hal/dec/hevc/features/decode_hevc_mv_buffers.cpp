@@ -48,7 +48,7 @@ MOS_BUFFER* HevcMvBufferOpInf::Allocate()
     uint32_t mvtbSize   = ((((m_basicFeature->m_width + 31) >> 5) * (((m_basicFeature->m_height + 31) >> 5)) + 1)&(-2));
     uint32_t bufferSize = MOS_MAX(mvtSize, mvtbSize) * MHW_CACHELINE_SIZE;
 
-    auto buffer = m_allocator->AllocateBuffer(bufferSize, "MvTemporalBuffer",
+    auto buffer = m_allocator->AllocatePooledBuffer(bufferSize, "MvTemporalBuffer",
         resourceInternalReadWriteCache, notLockableVideoMem);
 
     return buffer;
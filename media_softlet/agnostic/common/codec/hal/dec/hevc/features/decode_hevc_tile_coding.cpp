@@ -28,6 +28,7 @@
 #include "decode_hevc_basic_feature.h"
 #include "codec_def_common.h"
 #include "decode_pipeline.h"
+#include "media_worker_pool.h"
 
 namespace decode
 {
@@ -148,6 +149,7 @@ MOS_STATUS HevcTileCoding::UpdateSliceTileInfo()
             m_pCtbAddrRsToTs = (uint32_t *)MOS_AllocAndZeroMemory(picSizeInCtbsY * sizeof(uint32_t));
             DECODE_CHK_NULL(m_pCtbAddrRsToTs);
             m_CurRsToTsTableSize = picSizeInCtbsY;
+            m_rsToTsValid        = false;
         }
         RsToTsAddrConvert(picParams, picSizeInCtbsY);
     }
@@ -300,9 +302,6 @@ MOS_STATUS HevcTileCoding::UpdateSubTileInfo(const CODEC_HEVC_PIC_PARAMS & picPa
 
 MOS_STATUS HevcTileCoding::RsToTsAddrConvert(const CODEC_HEVC_PIC_PARAMS &picParams, uint32_t picSizeInCtbsY)
 {
-    uint32_t tbX = 0;
-    uint32_t tbY = 0;
-    uint32_t ctbAddrRs = 0;
     uint32_t colBd[HEVC_NUM_MAX_TILE_COLUMN + 1] = {0};
     uint32_t rowBd[HEVC_NUM_MAX_TILE_ROW + 1]    = {0};
     uint32_t colWidth[HEVC_NUM_MAX_TILE_COLUMN + 1] = {0};
@@ -354,15 +353,27 @@ MOS_STATUS HevcTileCoding::RsToTsAddrConvert(const CODEC_HEVC_PIC_PARAMS &picPar
         rowBd[j + 1] = rowBd[j] + rowHeight[j];
     }
 
-    /* The list CtbAddrRsToTs[ctbAddrRs] for ctbAddrRs ranging from 0 to PicSizeInCtbsY - 1, inclusive,
-     * specifying the conversion from a CTB address in CTB raster scan of a picture to a CTB address in tile scan */
-    uint16_t tileX = 0, tileY = 0;
-    for (ctbAddrRs = 0; ctbAddrRs < picSizeInCtbsY; ctbAddrRs++)
+    // Table only depends on tile layout, which seldom changes between frames.
+    m_newRsToTsKey.clear();
+    m_newRsToTsKey.push_back(m_basicFeature->m_widthInCtb);
+    m_newRsToTsKey.push_back(m_basicFeature->m_heightInCtb);
+    m_newRsToTsKey.push_back(picSizeInCtbsY);
+    m_newRsToTsKey.insert(m_newRsToTsKey.end(), colWidth, colWidth + picParams.num_tile_columns_minus1 + 1);
+    m_newRsToTsKey.insert(m_newRsToTsKey.end(), rowHeight, rowHeight + picParams.num_tile_rows_minus1 + 1);
+    if (m_rsToTsValid && m_newRsToTsKey == m_rsToTsKey)
     {
-        tbX = ctbAddrRs % m_basicFeature->m_widthInCtb;
-        tbY = ctbAddrRs / m_basicFeature->m_widthInCtb;
+        return MOS_STATUS_SUCCESS;
+    }
+    m_rsToTsValid = false;
 
-        for (j = 0; j <= picParams.num_tile_rows_minus1; j++)
+    /* The list CtbAddrRsToTs[ctbAddrRs] for ctbAddrRs ranging from 0 to PicSizeInCtbsY - 1, inclusive,
+     * specifying the conversion from a CTB address in CTB raster scan of a picture to a CTB address in tile scan.
+     * Each CTB row is converted independently, so rows are spread over worker threads for large pictures. */
+    uint32_t widthInCtb = m_basicFeature->m_widthInCtb;
+    uint32_t ctbRows    = (widthInCtb == 0) ? 0 : MOS_ROUNDUP_DIVIDE(picSizeInCtbsY, widthInCtb);
+    auto convertRow = [&](uint32_t tbY) -> MOS_STATUS {
+        uint16_t tileY = 0;
+        for (uint8_t j = 0; j <= picParams.num_tile_rows_minus1; j++)
         {
             if (tbY >= rowBd[j])
             {
@@ -370,26 +381,27 @@ MOS_STATUS HevcTileCoding::RsToTsAddrConvert(const CODEC_HEVC_PIC_PARAMS &picPar
             }
         }
 
-        for (i = 0; i <= picParams.num_tile_columns_minus1; i++)
+        uint32_t rowStart = tbY * widthInCtb;
+        uint32_t rowEnd   = MOS_MIN(rowStart + widthInCtb, picSizeInCtbsY);
+        uint16_t tileX    = 0;
+        for (uint32_t ctbAddrRs = rowStart; ctbAddrRs < rowEnd; ctbAddrRs++)
         {
-            if (tbX >= colBd[i])
+            uint32_t tbX = ctbAddrRs - rowStart;
+            while (tileX < picParams.num_tile_columns_minus1 && tbX >= colBd[tileX + 1])
             {
-                tileX = i;
+                tileX++;
             }
-        }
 
-        m_pCtbAddrRsToTs[ctbAddrRs] = 0;
-        for (i = 0; i < tileX; i++)
-        {
-            m_pCtbAddrRsToTs[ctbAddrRs] += rowHeight[tileY] * colWidth[i];
-        }
-        for (j = 0; j < tileY; j++)
-        {
-            m_pCtbAddrRsToTs[ctbAddrRs] += m_basicFeature->m_widthInCtb * rowHeight[j];
+            // CTBs of tiles on the left in this tile row, then CTBs of tile rows above.
+            m_pCtbAddrRsToTs[ctbAddrRs] = rowHeight[tileY] * colBd[tileX] + widthInCtb * rowBd[tileY] +
+                (tbY - rowBd[tileY]) * colWidth[tileX] + tbX - colBd[tileX];
         }
+        return MOS_STATUS_SUCCESS;
+    };
+    DECODE_CHK_STATUS(MediaWorkerPool::GetInstance()->ParallelFor(ctbRows, convertRow));
 
-        m_pCtbAddrRsToTs[ctbAddrRs] += (tbY - rowBd[tileY]) * colWidth[tileX] + tbX - colBd[tileX];
-    }
+    m_rsToTsKey.swap(m_newRsToTsKey);
+    m_rsToTsValid = true;
 
     return MOS_STATUS_SUCCESS;
 }
@@ -247,6 +247,9 @@ protected:
     uint16_t            m_tileRowHeight[HEVC_NUM_MAX_TILE_ROW];     //!< Table of tile row height
     uint32_t            *m_pCtbAddrRsToTs = nullptr;                //!< Entry of raster scan to tile scan map
     uint32_t            m_CurRsToTsTableSize = 0;                   //!< Record of current rs to ts map table size
+    std::vector<uint32_t> m_rsToTsKey;                              //!< Tile layout m_pCtbAddrRsToTs is built for
+    std::vector<uint32_t> m_newRsToTsKey;                           //!< Tile layout of current frame
+    bool                m_rsToTsValid = false;                      //!< Whether m_rsToTsKey matches m_pCtbAddrRsToTs
 
     std::vector<SliceTileInfo*> m_sliceTileInfoList;                //!< List of slice tile info
 
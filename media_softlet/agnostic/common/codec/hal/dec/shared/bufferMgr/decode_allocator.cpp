@@ -46,10 +46,18 @@ DecodeAllocator::DecodeAllocator(PMOS_INTERFACE osInterface, bool limitedLMemBar
 #if (_DEBUG || _RELEASE_INTERNAL)
     m_forceLockable = ReadUserFeature(m_osInterface->pfnGetUserSettingInstance(m_osInterface), "ForceDecodeResourceLockable", MediaUserSetting::Group::Sequence).Get<uint32_t>();
 #endif
+    uint32_t poolSizeInMB = ReadUserFeature(m_osInterface->pfnGetUserSettingInstance(m_osInterface),
+        "Decode Buffer Pool High Water Mark", MediaUserSetting::Group::Sequence).Get<uint32_t>();
+    if (poolSizeInMB > 0)
+    {
+        m_bufferPool = DecodeBufferPool::Attach(m_osInterface, uint64_t(poolSizeInMB) << 20);
+    }
 }
 
 DecodeAllocator::~DecodeAllocator()
 {
+    DecodeBufferPool::Detach(m_bufferPool, m_osInterface);
+    m_bufferPool = nullptr;
     MOS_Delete(m_allocator);
 }
 
@@ -97,6 +105,28 @@ MOS_BUFFER* DecodeAllocator::AllocateBuffer(
     return buffer;
 }
 
+MOS_BUFFER* DecodeAllocator::AllocatePooledBuffer(
+    const uint32_t sizeOfBuffer, const char* nameOfBuffer,
+    ResourceUsage resUsageType, ResourceAccessReq accessReq)
+{
+    if (m_bufferPool == nullptr)
+    {
+        return AllocateBuffer(sizeOfBuffer, nameOfBuffer, resUsageType, accessReq);
+    }
+
+    MOS_ALLOC_GFXRES_PARAMS allocParams;
+    MOS_ZeroMemory(&allocParams, sizeof(MOS_ALLOC_GFXRES_PARAMS));
+    allocParams.Type            = MOS_GFXRES_BUFFER;
+    allocParams.TileType        = MOS_TILE_LINEAR;
+    allocParams.Format          = Format_Buffer;
+    allocParams.dwBytes         = sizeOfBuffer;
+    allocParams.pBufName        = nameOfBuffer;
+    allocParams.ResUsageType    = static_cast<MOS_HW_RESOURCE_DEF>(resUsageType);
+    SetAccessRequirement(accessReq, allocParams);
+
+    return m_bufferPool->Acquire(m_osInterface, allocParams);
+}
+
 BufferArray * DecodeAllocator::AllocateBufferArray(
     const uint32_t sizeOfBuffer, const char* nameOfBuffer, const uint32_t numberOfBuffer,
     ResourceUsage resUsageType, ResourceAccessReq accessReq,
@@ -396,6 +426,27 @@ MOS_STATUS DecodeAllocator::Resize(MOS_BUFFER* &buffer, const uint32_t sizeNew,
         return MOS_STATUS_SUCCESS;
     }
 
+    if ((force || (sizeNew > buffer->size)) && m_bufferPool != nullptr && m_bufferPool->IsPooled(buffer))
+    {
+        ResourceUsage resUsageType = ConvertGmmResourceUsage(buffer->OsResource.pGmmResInfo->GetCachePolicyUsage());
+        MOS_BUFFER* bufferNew = AllocatePooledBuffer(sizeNew, buffer->name, resUsageType, accessReq);
+        DECODE_CHK_NULL(bufferNew);
+
+        // Pooled buffer may hold data of a previous user, clear it explicitly
+        if (clearData)
+        {
+            DECODE_ASSERT(accessReq != notLockableVideoMem);
+            if (m_allocator->OsFillResource(&bufferNew->OsResource, bufferNew->size, 0) != MOS_STATUS_SUCCESS)
+            {
+                DECODE_ASSERTMESSAGE("Failed to clear buffer data");
+            }
+        }
+
+        Destroy(buffer);
+        buffer = bufferNew;
+        return MOS_STATUS_SUCCESS;
+    }
+
     if (force || (sizeNew > buffer->size))
     {
         if(clearData)
@@ -468,6 +519,12 @@ MOS_STATUS DecodeAllocator::Destroy(MOS_BUFFER* & buffer)
         return MOS_STATUS_SUCCESS;
     }
 
+    if (m_bufferPool != nullptr && m_bufferPool->Release(m_osInterface, buffer))
+    {
+        buffer = nullptr;
+        return MOS_STATUS_SUCCESS;
+    }
+
     DECODE_CHK_STATUS(m_allocator->DestroyBuffer(buffer));
     buffer = nullptr;
     return MOS_STATUS_SUCCESS;
@@ -659,6 +716,17 @@ ResourceUsage DecodeAllocator::ConvertGmmResourceUsage(const GMM_RESOURCE_USAGE_
     return (ResourceUsage)gmmUsage;
 }
 
+MOS_STATUS DecodeAllocator::GetBufferPoolStatistics(DecodeBufferPool::Statistics &stats)
+{
+    if (m_bufferPool == nullptr)
+    {
+        return MOS_STATUS_UNIMPLEMENTED;
+    }
+
+    stats = m_bufferPool->GetStatistics();
+    return MOS_STATUS_SUCCESS;
+}
+
 void DecodeAllocator::SetAccessRequirement(
     ResourceAccessReq accessReq, MOS_ALLOC_GFXRES_PARAMS &allocParams)
 {
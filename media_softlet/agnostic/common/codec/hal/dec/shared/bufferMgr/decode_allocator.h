@@ -37,6 +37,7 @@
 #include "mos_os_specific.h"
 #include "mos_resource_defs.h"
 #include "External/Common/GmmCachePolicyExt.h"
+#include "decode_buffer_pool.h"
 #include <stdint.h>
 #include <vector>
 class Allocator;
@@ -111,6 +112,26 @@ public:
         ResourceUsage resUsageType = resourceDefault, ResourceAccessReq accessReq = lockableVideoMem,
         bool initOnAllocate = false, uint8_t initValue = 0, bool bPersistent = false);
 
+    //!
+    //! \brief  Allocate buffer from device wide buffer pool
+    //! \details Pooled buffer is returned to pool when destroyed, and can be
+    //!          reused across sequence changes and decode instances. The size
+    //!          of pooled buffer is rounded up to pool size class. Fall back to
+    //!          AllocateBuffer if buffer pool is disabled.
+    //! \param  [in] sizeOfBuffer
+    //!         Buffer size
+    //! \param  [in] nameOfBuffer
+    //!         Buffer name
+    //! \param  [in] resUsageType
+    //!         ResourceUsage to be set
+    //! \param  [in] accessReq
+    //!         Resource access requirement, by default is lockable
+    //! \return MOS_BUFFER*
+    //!         return the pointer to MOS_BUFFER
+    //!
+    MOS_BUFFER* AllocatePooledBuffer(const uint32_t sizeOfBuffer, const char* nameOfBuffer,
+        ResourceUsage resUsageType = resourceDefault, ResourceAccessReq accessReq = lockableVideoMem);
+
     //!
     //! \brief  Allocate buffer array
     //! \param  [in] sizeOfBuffer
@@ -536,6 +557,15 @@ public:
     //!
     ResourceUsage ConvertGmmResourceUsage(const GMM_RESOURCE_USAGE_TYPE gmmResUsage);
 
+    //!
+    //! \brief    Get statistics of device wide buffer pool
+    //! \param    [out] stats
+    //!           Buffer pool statistics
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, MOS_STATUS_UNIMPLEMENTED if pool is disabled
+    //!
+    MOS_STATUS GetBufferPoolStatistics(DecodeBufferPool::Statistics &stats);
+
 protected:
     //!
     //! \brief    Apply resource access requirement to allocate parameters
@@ -551,6 +581,7 @@ protected:
     PMOS_INTERFACE m_osInterface = nullptr;  //!< PMOS_INTERFACE
     Allocator *m_allocator = nullptr;
     bool m_limitedLMemBar = false; //!< Indicate if running with limited LMem bar config
+    DecodeBufferPool *m_bufferPool = nullptr; //!< Device wide buffer pool, nullptr if disabled
 
 #if (_DEBUG || _RELEASE_INTERNAL)
     bool m_forceLockable = false;
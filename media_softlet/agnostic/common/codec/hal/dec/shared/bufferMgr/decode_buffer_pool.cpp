@@ -0,0 +1,277 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_buffer_pool.cpp
+//! \brief    Implements the size classed buffer pool shared by decode instances
+//!
+
+#include "decode_buffer_pool.h"
+#include "decode_utils.h"
+
+namespace decode {
+
+std::mutex                           DecodeBufferPool::m_poolsMutex;
+std::map<void *, DecodeBufferPool *> DecodeBufferPool::m_pools;
+
+static const uint32_t minSizeClass = 0x10000;  // 64KB
+
+DecodeBufferPool *DecodeBufferPool::Attach(PMOS_INTERFACE osInterface, uint64_t highWaterMark)
+{
+    if (osInterface == nullptr || osInterface->osStreamState == nullptr ||
+        osInterface->osStreamState->osDeviceContext == nullptr)
+    {
+        return nullptr;
+    }
+
+    void *device = osInterface->osStreamState->osDeviceContext;
+
+    std::lock_guard<std::mutex> lock(m_poolsMutex);
+
+    DecodeBufferPool *pool = nullptr;
+    auto              it   = m_pools.find(device);
+    if (it == m_pools.end())
+    {
+        pool = MOS_New(DecodeBufferPool);
+        if (pool == nullptr)
+        {
+            return nullptr;
+        }
+        m_pools.insert(std::make_pair(device, pool));
+    }
+    else
+    {
+        pool = it->second;
+    }
+
+    std::lock_guard<std::mutex> poolLock(pool->m_mutex);
+    pool->m_refCount++;
+    // Pool is shared by all decode instances on the device, honor the largest setting.
+    pool->m_highWaterMark = MOS_MAX(pool->m_highWaterMark, highWaterMark);
+
+    return pool;
+}
+
+void DecodeBufferPool::Detach(DecodeBufferPool *pool, PMOS_INTERFACE osInterface)
+{
+    if (pool == nullptr || osInterface == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_poolsMutex);
+
+    bool lastUser = false;
+    {
+        std::lock_guard<std::mutex> poolLock(pool->m_mutex);
+        DECODE_ASSERT(pool->m_refCount > 0);
+        pool->m_refCount--;
+        if (pool->m_refCount == 0)
+        {
+            // Device may be destroyed after the last decode instance goes away,
+            // so all pooled buffers must be returned to OS here.
+            pool->Trim(osInterface, 0);
+            if (!pool->m_pooled.empty())
+            {
+                DECODE_ASSERTMESSAGE("%zu pooled buffers are not released before detach", pool->m_pooled.size());
+                for (auto &item : pool->m_pooled)
+                {
+                    pool->FreeBuffer(osInterface, item.first);
+                }
+                pool->m_pooled.clear();
+            }
+            lastUser = true;
+        }
+    }
+
+    if (lastUser)
+    {
+        for (auto it = m_pools.begin(); it != m_pools.end(); it++)
+        {
+            if (it->second == pool)
+            {
+                m_pools.erase(it);
+                break;
+            }
+        }
+        MOS_Delete(pool);
+    }
+}
+
+uint32_t DecodeBufferPool::GetSizeClass(uint32_t size)
+{
+    if (size <= minSizeClass)
+    {
+        return minSizeClass;
+    }
+
+    // Four classes per power of two, which bounds the waste to 25%.
+    uint32_t msb = 0;
+    for (uint32_t value = size - 1; value > 1; value >>= 1)
+    {
+        msb++;
+    }
+    uint32_t step = 1u << (msb - 2);
+
+    return MOS_ALIGN_CEIL(size, step);
+}
+
+MOS_BUFFER *DecodeBufferPool::Acquire(PMOS_INTERFACE osInterface, MOS_ALLOC_GFXRES_PARAMS &allocParams)
+{
+    DECODE_FUNC_CALL();
+
+    if (osInterface == nullptr)
+    {
+        return nullptr;
+    }
+
+    PoolKey key;
+    key.sizeClass    = GetSizeClass(allocParams.dwBytes);
+    key.memType      = allocParams.dwMemType;
+    key.notLockable  = allocParams.Flags.bNotLockable;
+    key.resUsageType = allocParams.ResUsageType;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Released buffers may still be read by GPU work submitted before the
+        // release. Take the oldest one which GPU is done with, the buffer
+        // released last is the most likely one to be in flight.
+        for (auto it = m_freeList.begin(); it != m_freeList.end(); it++)
+        {
+            if (it->key == key && !IsBusy(osInterface, it->buffer))
+            {
+                MOS_BUFFER *buffer = it->buffer;
+                m_freeList.erase(it);
+                m_stats.cachedBytes -= key.sizeClass;
+                m_stats.reuseCount++;
+                buffer->name = allocParams.pBufName;
+                return buffer;
+            }
+        }
+    }
+
+    allocParams.dwBytes = key.sizeClass;
+
+    MOS_BUFFER *buffer = MOS_New(MOS_BUFFER);
+    if (buffer == nullptr)
+    {
+        return nullptr;
+    }
+    MOS_ZeroMemory(buffer, sizeof(MOS_BUFFER));
+
+    if (osInterface->pfnAllocateResource(osInterface, &allocParams, &buffer->OsResource) != MOS_STATUS_SUCCESS)
+    {
+        MOS_Delete(buffer);
+        return nullptr;
+    }
+    buffer->size        = key.sizeClass;
+    buffer->name        = allocParams.pBufName;
+    buffer->bPersistent = allocParams.bIsPersistent;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pooled.insert(std::make_pair(buffer, key));
+    m_stats.allocCount++;
+
+    return buffer;
+}
+
+bool DecodeBufferPool::Release(PMOS_INTERFACE osInterface, MOS_BUFFER *buffer)
+{
+    DECODE_FUNC_CALL();
+
+    if (buffer == nullptr || osInterface == nullptr)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_pooled.find(buffer);
+    if (it == m_pooled.end())
+    {
+        return false;
+    }
+
+    PoolKey key = it->second;
+    if (m_stats.cachedBytes + key.sizeClass > m_highWaterMark)
+    {
+        Trim(osInterface, m_highWaterMark > key.sizeClass ? m_highWaterMark - key.sizeClass : 0);
+    }
+
+    if (m_stats.cachedBytes + key.sizeClass > m_highWaterMark)
+    {
+        m_pooled.erase(it);
+        FreeBuffer(osInterface, buffer);
+        return true;
+    }
+
+    PoolEntry entry = {key, buffer};
+    m_freeList.push_back(entry);
+    m_stats.cachedBytes += key.sizeClass;
+    m_stats.peakBytes = MOS_MAX(m_stats.peakBytes, m_stats.cachedBytes);
+
+    return true;
+}
+
+bool DecodeBufferPool::IsPooled(MOS_BUFFER *buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pooled.find(buffer) != m_pooled.end();
+}
+
+DecodeBufferPool::Statistics DecodeBufferPool::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+bool DecodeBufferPool::IsBusy(PMOS_INTERFACE osInterface, MOS_BUFFER *buffer)
+{
+    // Without a busy query the buffer can not be proven idle.
+    if (osInterface->pfnIsResourceBusy == nullptr)
+    {
+        return true;
+    }
+    return osInterface->pfnIsResourceBusy(osInterface, &buffer->OsResource);
+}
+
+void DecodeBufferPool::FreeBuffer(PMOS_INTERFACE osInterface, MOS_BUFFER *buffer)
+{
+    osInterface->pfnFreeResource(osInterface, &buffer->OsResource);
+    MOS_Delete(buffer);
+    m_stats.freeCount++;
+}
+
+void DecodeBufferPool::Trim(PMOS_INTERFACE osInterface, uint64_t targetBytes)
+{
+    // Evict oldest idle buffers first, caller must hold m_mutex.
+    auto it = m_freeList.begin();
+    while (it != m_freeList.end() && m_stats.cachedBytes > targetBytes)
+    {
+        m_stats.cachedBytes -= it->key.sizeClass;
+        m_pooled.erase(it->buffer);
+        FreeBuffer(osInterface, it->buffer);
+        it = m_freeList.erase(it);
+    }
+}
+
+}  // namespace decode
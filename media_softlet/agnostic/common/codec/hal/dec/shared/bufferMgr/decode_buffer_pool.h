@@ -0,0 +1,167 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_buffer_pool.h
+//! \brief    Defines the size classed buffer pool shared by decode instances
+//! \details  Reference associated buffers (MV temporal buffers, AV1 temporal
+//!           buffers, etc.) are released and reallocated on each sequence
+//!           change. The pool keeps such buffers per device in size classes so
+//!           they can be picked up again by any decode instance on the device.
+//!
+
+#ifndef __DECODE_BUFFER_POOL_H__
+#define __DECODE_BUFFER_POOL_H__
+
+#include "mos_os.h"
+#include "media_class_trace.h"
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace decode {
+
+class DecodeBufferPool
+{
+public:
+    DecodeBufferPool() {}
+    virtual ~DecodeBufferPool() {}
+
+    //!
+    //! \brief  Pool statistics
+    //!
+    struct Statistics
+    {
+        uint64_t allocCount   = 0;  //!< Buffers allocated from OS
+        uint64_t reuseCount   = 0;  //!< Requests served from the pool
+        uint64_t freeCount    = 0;  //!< Buffers returned to OS
+        uint64_t cachedBytes  = 0;  //!< Bytes currently held idle in the pool
+        uint64_t peakBytes    = 0;  //!< Peak of cachedBytes
+    };
+
+    //!
+    //! \brief  Attach to the pool of the device which osInterface belongs to
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \param  [in] highWaterMark
+    //!         Max bytes kept idle in the pool
+    //! \return DecodeBufferPool*
+    //!         Pointer to the device pool, nullptr if pooling is not supported
+    //!
+    static DecodeBufferPool *Attach(PMOS_INTERFACE osInterface, uint64_t highWaterMark);
+
+    //!
+    //! \brief  Detach from the device pool, idle buffers are freed by the last user
+    //! \param  [in] pool
+    //!         Pool returned by Attach
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \return void
+    //!
+    static void Detach(DecodeBufferPool *pool, PMOS_INTERFACE osInterface);
+
+    //!
+    //! \brief  Round up buffer size to pool size class
+    //! \param  [in] size
+    //!         Requested size
+    //! \return uint32_t
+    //!         Size of the class which covers requested size
+    //!
+    static uint32_t GetSizeClass(uint32_t size);
+
+    //!
+    //! \brief  Acquire buffer from pool, allocate if no idle buffer fits
+    //! \details Only buffers which are no longer used by GPU are reused
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \param  [in] allocParams
+    //!         Allocation parameters, dwBytes is rounded up to size class
+    //! \return MOS_BUFFER*
+    //!         Pointer to buffer, nullptr if fail
+    //!
+    MOS_BUFFER *Acquire(PMOS_INTERFACE osInterface, MOS_ALLOC_GFXRES_PARAMS &allocParams);
+
+    //!
+    //! \brief  Return buffer to pool
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \param  [in] buffer
+    //!         Buffer to be returned
+    //! \return bool
+    //!         true if buffer is owned by pool, false if buffer is not pooled
+    //!
+    bool Release(PMOS_INTERFACE osInterface, MOS_BUFFER *buffer);
+
+    //!
+    //! \brief  Check if buffer is allocated from pool
+    //! \param  [in] buffer
+    //!         Buffer to be checked
+    //! \return bool
+    //!         true if pooled
+    //!
+    bool IsPooled(MOS_BUFFER *buffer);
+
+    //!
+    //! \brief  Get pool statistics
+    //! \return Statistics
+    //!
+    Statistics GetStatistics();
+
+protected:
+    struct PoolKey
+    {
+        uint32_t            sizeClass;
+        uint32_t            memType;
+        uint32_t            notLockable;
+        MOS_HW_RESOURCE_DEF resUsageType;
+
+        bool operator==(const PoolKey &other) const
+        {
+            return sizeClass == other.sizeClass && memType == other.memType &&
+                   notLockable == other.notLockable && resUsageType == other.resUsageType;
+        }
+    };
+
+    struct PoolEntry
+    {
+        PoolKey     key;
+        MOS_BUFFER *buffer;
+    };
+
+    bool IsBusy(PMOS_INTERFACE osInterface, MOS_BUFFER *buffer);
+    void FreeBuffer(PMOS_INTERFACE osInterface, MOS_BUFFER *buffer);
+    void Trim(PMOS_INTERFACE osInterface, uint64_t targetBytes);
+
+    std::mutex                                  m_mutex;
+    std::vector<PoolEntry>                      m_freeList;     //!< Idle buffers in release order, oldest first
+    std::map<MOS_BUFFER *, PoolKey>             m_pooled;       //!< All buffers owned by pool
+    uint64_t                                    m_highWaterMark = 0;
+    uint32_t                                    m_refCount      = 0;
+    Statistics                                  m_stats;
+
+    static std::mutex                               m_poolsMutex;
+    static std::map<void *, DecodeBufferPool *>     m_pools;     //!< Pools indexed by device handle
+
+MEDIA_CLASS_DEFINE_END(decode__DecodeBufferPool)
+};
+
+}  // namespace decode
+#endif  // !__DECODE_BUFFER_POOL_H__
@@ -20,11 +20,13 @@
 set(SOFTLET_DECODE_COMMON_SOURCES_
     ${SOFTLET_DECODE_COMMON_SOURCES_}
     ${CMAKE_CURRENT_LIST_DIR}/decode_allocator.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/decode_buffer_pool.cpp
 )
 
 set(SOFTLET_DECODE_COMMON_HEADERS_
     ${SOFTLET_DECODE_COMMON_HEADERS_}
     ${CMAKE_CURRENT_LIST_DIR}/decode_allocator.h
+    ${CMAKE_CURRENT_LIST_DIR}/decode_buffer_pool.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_resource_array.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_resource_auto_lock.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_reference_associated_buffer.h
@@ -261,6 +261,14 @@ MOS_STATUS DecodePipeline::Uninitialize()
 MOS_STATUS DecodePipeline::UserFeatureReport()
 {
     DECODE_FUNC_CALL();
+
+    DecodeBufferPool::Statistics poolStats;
+    if (m_allocator != nullptr && m_allocator->GetBufferPoolStatistics(poolStats) == MOS_STATUS_SUCCESS)
+    {
+        ReportUserSetting(m_userSettingPtr, "Decode Buffer Pool Alloc Count", uint32_t(poolStats.allocCount), MediaUserSetting::Group::Sequence);
+        ReportUserSetting(m_userSettingPtr, "Decode Buffer Pool Reuse Count", uint32_t(poolStats.reuseCount), MediaUserSetting::Group::Sequence);
+    }
+
     return MediaPipeline::UserFeatureReport();
 }
 
@@ -64,6 +64,46 @@ public:
     virtual CODECHAL_DUMMY_REFERENCE_STATUS GetDummyReferenceStatus() = 0;
     virtual void SetDummyReferenceStatus(CODECHAL_DUMMY_REFERENCE_STATUS status) = 0;
     virtual uint32_t GetCompletedReport() = 0;
+
+    //!
+    //! \brief  Get all status reports completed since last call
+    //! \details Status records are written by GPU into the status report ring
+    //!          along with a completed count, so every record up to that count
+    //!          can be consumed in one go. Reports are returned in completion
+    //!          order, unlike GetStatusReport with more than one report.
+    //! \param  [out] status
+    //!         Array of reports, at least maxNum entries of reportSize bytes
+    //! \param  [in] reportSize
+    //!         Size of one report in bytes
+    //! \param  [in] maxNum
+    //!         Max number of reports to return
+    //! \param  [out] numReported
+    //!         Number of reports returned
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS GetCompletedStatusReports(void *status, uint32_t reportSize, uint32_t maxNum, uint32_t &numReported)
+    {
+        numReported = 0;
+        if (status == nullptr)
+        {
+            return MOS_STATUS_NULL_POINTER;
+        }
+
+        uint32_t numCompleted = MOS_MIN(GetCompletedReport(), maxNum);
+        while (numReported < numCompleted)
+        {
+            // Single report is taken from the oldest completed one.
+            MOS_STATUS eStatus = GetStatusReport((uint8_t *)status + reportSize * numReported, 1);
+            if (eStatus != MOS_STATUS_SUCCESS)
+            {
+                return eStatus;
+            }
+            numReported++;
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
     virtual MOS_GPU_CONTEXT GetDecodeContext() = 0;
     virtual GPU_CONTEXT_HANDLE GetDecodeContextHandle() = 0;
     virtual MOS_STATUS SetDecodeFormat(bool isShortFormat ){ return MOS_STATUS_UNIMPLEMENTED; };
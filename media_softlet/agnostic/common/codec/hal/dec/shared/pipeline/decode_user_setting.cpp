@@ -170,6 +170,24 @@ MOS_STATUS DecodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         MediaUserSetting::Group::Sequence,
         uint32_t(0),
         true);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Buffer Pool High Water Mark",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Buffer Pool Alloc Count",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        true);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Buffer Pool Reuse Count",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        true);
 #if (_DEBUG || _RELEASE_INTERNAL)
     DeclareUserSettingKeyForDebug(
         userSettingPtr,
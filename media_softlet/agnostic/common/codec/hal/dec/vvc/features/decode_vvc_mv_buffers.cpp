@@ -59,7 +59,7 @@ MOS_BUFFER* VvcMvBufferOpInf::Allocate()
         return nullptr;
     }
 
-    return m_allocator->AllocateBuffer(
+    return m_allocator->AllocatePooledBuffer(
         vvcpBufSizeParam.m_bufferSize,
         "MvTemporalBuffer",
         resourceInternalReadWriteCache,
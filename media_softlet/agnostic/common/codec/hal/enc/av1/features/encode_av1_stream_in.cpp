@@ -40,6 +40,7 @@ namespace encode
         }
 
         MOS_SafeFreeMemory(m_streamInTemp);
+        MOS_Delete(m_streamInUploader);
     }
 
     static void SetCommonParams(uint8_t tu, CommonStreamInParams& params)
@@ -118,9 +119,18 @@ namespace encode
                                   (MOS_ALIGN_CEIL(CurFrameHeight, 64) / m_streamInBlockSize) * CODECHAL_CACHELINE_SIZE;
 
             m_streamInSize = allocParams.dwBytes;
+            MOS_SafeFreeMemory(m_streamInTemp);
             m_streamInTemp = (uint8_t *)MOS_AllocAndZeroMemory(m_streamInSize);
             ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
+            // Stream in layout changes with resolution, content tracked so far is stale.
+            if (m_streamInUploader == nullptr)
+            {
+                m_streamInUploader = MOS_New(EncodeStreamInUploader, m_allocator);
+                ENCODE_CHK_NULL_RETURN(m_streamInUploader);
+            }
+            m_streamInUploader->Reset();
+
             allocParams.pBufName = "Av1 StreamIn Data Buffer";
             allocParams.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_WRITE;
             m_basicFeature->m_recycleBuf->RegisterResource(RecycleResId::StreamInBuffer, allocParams);
@@ -269,12 +279,11 @@ namespace encode
         m_streamInBuffer = m_basicFeature->m_recycleBuf->GetBuffer(RecycleResId::StreamInBuffer, m_basicFeature->m_frameNum);
         ENCODE_CHK_NULL_RETURN(m_streamInBuffer);
 
-        uint8_t *streaminBuffer = (uint8_t *)m_allocator->LockResourceForWrite(m_streamInBuffer);
-        ENCODE_CHK_NULL_RETURN(streaminBuffer);
-
-        MOS_SecureMemcpy(streaminBuffer, m_streamInSize, m_streamInTemp, m_streamInSize);
+        ENCODE_CHK_NULL_RETURN(m_streamInUploader);
 
-        m_allocator->UnLock(m_streamInBuffer);
+        // One superblock row in tile scan order per comparison unit
+        uint32_t rowSize = m_widthInLCU * m_num32x32BlocksInLCU * CODECHAL_CACHELINE_SIZE;
+        ENCODE_CHK_STATUS_RETURN(m_streamInUploader->Upload(m_streamInBuffer, m_streamInTemp, m_streamInSize, rowSize));
 
         return MOS_STATUS_SUCCESS;
     }
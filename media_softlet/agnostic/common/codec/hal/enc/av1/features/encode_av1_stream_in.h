@@ -27,6 +27,7 @@
 #define __ENCODE_AV1_STREAM_IN_H__
 #include "mhw_vdbox.h"
 #include "encode_allocator.h"
+#include "encode_stream_in_uploader.h"
 #include "codec_def_encode_av1.h"
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_avp_itf.h"
@@ -311,6 +312,8 @@ protected:
     uint8_t *m_streamInTemp = nullptr;
     uint32_t m_streamInSize = 0;
 
+    EncodeStreamInUploader *m_streamInUploader = nullptr;  //!< Copies changed stream in rows to recycled buffers
+
 MEDIA_CLASS_DEFINE_END(encode__Av1StreamIn)
 };
 
@@ -374,6 +374,22 @@ namespace encode
 
         ENCODE_CHK_STATUS_RETURN(CalculateNumLcuByTiles(av1PicParams));
 
+        // Tile layout of 8K content with many tiles is rarely changed, skip the
+        // per tile derivation below if none of its inputs changed.
+        m_newTileLayoutKey.clear();
+        m_newTileLayoutKey.push_back(m_numTileRows);
+        m_newTileLayoutKey.push_back(m_numTileColumns);
+        m_newTileLayoutKey.push_back(av1PicParams->frame_width_minus1);
+        m_newTileLayoutKey.push_back(av1PicParams->frame_height_minus1);
+        m_newTileLayoutKey.push_back(m_basicFeature->m_bitstreamSize);
+        m_newTileLayoutKey.push_back(((Av1BasicFeature *)m_basicFeature)->m_sizeOfSseSrcPixelRowStoreBufferPerLcu);
+        m_newTileLayoutKey.insert(m_newTileLayoutKey.end(), av1PicParams->width_in_sbs_minus_1, av1PicParams->width_in_sbs_minus_1 + m_numTileColumns);
+        m_newTileLayoutKey.insert(m_newTileLayoutKey.end(), av1PicParams->height_in_sbs_minus_1, av1PicParams->height_in_sbs_minus_1 + m_numTileRows);
+        if (!IsTileLayoutChanged())
+        {
+            return eStatus;
+        }
+
         for ( uint32_t i = 0; i < m_numTileRows; i++)
         {
             for (uint32_t j = 0; j < m_numTileColumns; j++)
@@ -443,6 +459,8 @@ namespace encode
             sseRowstoreOffset = 0;
         }
 
+        CommitTileLayout();
+
         return eStatus;
     }
 
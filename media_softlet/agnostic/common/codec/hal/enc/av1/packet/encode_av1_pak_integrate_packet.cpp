@@ -559,7 +559,7 @@ namespace encode {
             uint32_t offset = MOS_ALIGN_CEIL(tileReportData[i].bitstreamByteOffset * CODECHAL_CACHELINE_SIZE, MOS_PAGE_SIZE);
             uint32_t len    = tileRecord[i].Length;
 
-            MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+            MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
             bufPtr += len;
         }
 
@@ -37,6 +37,20 @@ namespace encode {
 #define VDENC_AVC_STATIC_FRAME_INTRACOSTSCLRatioP   240
 #define VDENC_AVC_BRC_HUC_STATUS_REENCODE_MASK      (1 << 31)
 
+AvcHucBrcUpdatePkt::~AvcHucBrcUpdatePkt()
+{
+    if (m_constBufferPool != nullptr)
+    {
+        for (uint32_t i = 0; i < CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM; i++)
+        {
+            m_constBufferPool->Release(m_osInterface, m_vdencBrcConstDataBuffer[i]);
+            m_vdencBrcConstDataBuffer[i] = nullptr;
+        }
+        EncodeConstBufferPool::Detach(m_constBufferPool, m_osInterface);
+        m_constBufferPool = nullptr;
+    }
+}
+
 MOS_STATUS AvcHucBrcUpdatePkt::Init()
 {
     ENCODE_FUNC_CALL();
@@ -122,15 +136,20 @@ MOS_STATUS AvcHucBrcUpdatePkt::AllocateResources()
     allocParamsForBufferLinear.TileType = MOS_TILE_LINEAR;
     allocParamsForBufferLinear.Format   = Format_Buffer;
 
-    // Const Data buffer
-    allocParamsForBufferLinear.dwBytes  = MOS_ALIGN_CEIL(m_vdencBrcConstDataBufferSize, CODECHAL_PAGE_SIZE);
-    allocParamsForBufferLinear.pBufName = "VDENC BRC Const Data Buffer";
-    allocParamsForBufferLinear.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_WRITE;
-    for (uint32_t i = 0; i < CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM; i++)
+    // Const Data buffer, identical for all streams with same settings, so shared over device when possible.
+    // Buffers are picked up from pool on BRC init.
+    m_constBufferPool = EncodeConstBufferPool::Attach(m_osInterface);
+    if (m_constBufferPool == nullptr)
     {
-        allocatedbuffer = m_allocator->AllocateResource(allocParamsForBufferLinear, true);
-        ENCODE_CHK_NULL_RETURN(allocatedbuffer);
-        m_vdencBrcConstDataBuffer[i] = allocatedbuffer;
+        allocParamsForBufferLinear.dwBytes  = MOS_ALIGN_CEIL(m_vdencBrcConstDataBufferSize, CODECHAL_PAGE_SIZE);
+        allocParamsForBufferLinear.pBufName = "VDENC BRC Const Data Buffer";
+        allocParamsForBufferLinear.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_WRITE;
+        for (uint32_t i = 0; i < CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM; i++)
+        {
+            allocatedbuffer = m_allocator->AllocateResource(allocParamsForBufferLinear, true);
+            ENCODE_CHK_NULL_RETURN(allocatedbuffer);
+            m_vdencBrcConstDataBuffer[i] = allocatedbuffer;
+        }
     }
 
     for (uint32_t k = 0; k < CODECHAL_ENCODE_RECYCLED_BUFFER_NUM; k++)
@@ -182,19 +201,17 @@ MOS_STATUS AvcHucBrcUpdatePkt::SetConstDataHuCBrcUpdate()const
     {
         for (uint8_t picType = 0; picType < CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM; picType++)
         {
-            auto hucConstData = (uint8_t *)m_allocator->LockResourceForWrite(m_vdencBrcConstDataBuffer[picType]);
-            ENCODE_CHK_NULL_RETURN(hucConstData);
+            auto hucConstData = (uint8_t *)&m_vdencBrcConstData[picType];
 
             RUN_FEATURE_INTERFACE_RETURN(AvcEncodeBRC, AvcFeatureIDs::avcBrcFeature, FillHucConstData, hucConstData, picType);
 
-            m_allocator->UnLock(m_vdencBrcConstDataBuffer[picType]);
+            ENCODE_CHK_STATUS_RETURN(UploadConstData(picType));
         }
     }
 
     if (m_vdencStaticFrame)
     {
-        auto hucConstData = (VdencAvcHucBrcConstantData *)m_allocator->LockResourceForWrite(m_vdencBrcConstDataBuffer[GetCurrConstDataBufIdx()]);
-        ENCODE_CHK_NULL_RETURN(hucConstData);
+        auto hucConstData = &m_vdencBrcConstData[GetCurrConstDataBufIdx()];
 
         auto settings = static_cast<AvcVdencFeatureSettings *>(m_featureManager->GetFeatureSettings()->GetConstSettings());
         ENCODE_CHK_NULL_RETURN(settings);
@@ -206,12 +223,44 @@ MOS_STATUS AvcHucBrcUpdatePkt::SetConstDataHuCBrcUpdate()const
             hucConstData->UPD_P_Intra16x16[j] = constTable4[10 + j];
         }
 
-        m_allocator->UnLock(m_vdencBrcConstDataBuffer[GetCurrConstDataBufIdx()]);
+        ENCODE_CHK_STATUS_RETURN(UploadConstData(GetCurrConstDataBufIdx()));
     }
 
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS AvcHucBrcUpdatePkt::UploadConstData(uint32_t picType) const
+{
+    ENCODE_FUNC_CALL();
+    ENCODE_CHK_COND_RETURN(picType >= CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM, "Invalid const data buffer index %d", picType);
+
+    if (m_constBufferPool != nullptr)
+    {
+        // Pooled buffers are read-only, take the one holding new content and drop the old one.
+        PMOS_RESOURCE buffer = m_constBufferPool->Acquire(
+            m_osInterface,
+            encodeConstTableAvcHucBrcUpdate,
+            &m_vdencBrcConstData[picType],
+            m_vdencBrcConstDataBufferSize,
+            "VDENC BRC Const Data Buffer");
+        ENCODE_CHK_NULL_RETURN(buffer);
+
+        m_constBufferPool->Release(m_osInterface, m_vdencBrcConstDataBuffer[picType]);
+        m_vdencBrcConstDataBuffer[picType] = buffer;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    auto hucConstData = (uint8_t *)m_allocator->LockResourceForWrite(m_vdencBrcConstDataBuffer[picType]);
+    ENCODE_CHK_NULL_RETURN(hucConstData);
+
+    MOS_SecureMemcpy(hucConstData, m_vdencBrcConstDataBufferSize, &m_vdencBrcConstData[picType], m_vdencBrcConstDataBufferSize);
+
+    m_allocator->UnLock(m_vdencBrcConstDataBuffer[picType]);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS AvcHucBrcUpdatePkt::Execute(PMOS_COMMAND_BUFFER cmdBuffer, bool storeHucStatus2Needed, bool prologNeeded, HuCFunction function)
 {
     HUC_CHK_NULL_RETURN(cmdBuffer);
@@ -28,6 +28,7 @@
 #define __CODECHAL_AVC_HUC_BRC_UPDATE_PACKET_H__
 
 #include "encode_huc.h"
+#include "encode_const_buffer_pool.h"
 #if _ENCODE_RESERVED
 #include "encode_avc_huc_brc_update_packet_ext.h"
 #endif // _ENCODE_RESERVED
@@ -179,7 +180,7 @@ public:
     AvcHucBrcUpdatePkt(MediaPipeline *pipeline, MediaTask *task, CodechalHwInterfaceNext *hwInterface) :
         EncodeHucPkt(pipeline, task, hwInterface) {}
 
-    virtual ~AvcHucBrcUpdatePkt() {}
+    virtual ~AvcHucBrcUpdatePkt();
 
     virtual MOS_STATUS Init() override;
 
@@ -219,6 +220,17 @@ protected:
 
     virtual MOS_STATUS SetConstDataHuCBrcUpdate()const;
 
+    //!
+    //! \brief  Upload CPU copy of const data to the buffer of picture type
+    //! \details With shared pool, the buffer is swapped with a pooled buffer holding
+    //!          the same content instead of being written.
+    //! \param  [in] picType
+    //!         Index of const data buffer
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS UploadConstData(uint32_t picType) const;
+
     virtual MOS_STATUS ConstructImageStateReadBuffer(PMOS_RESOURCE imageStateBuffer);
 
     MHW_SETPAR_DECL_HDR(MFX_AVC_IMG_STATE);
@@ -252,7 +264,9 @@ protected:
     PMOS_RESOURCE m_vdencBrcImageStatesReadBufferOrigin[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM]               = {};  //!< Read-only VDENC+PAK IMG STATE buffer.
     PMOS_RESOURCE m_vdencBrcImageStatesReadBufferTU7[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM]                  = {};  //!< Read-only VDENC+PAK IMG STATE buffer.
     PMOS_RESOURCE m_vdencBrcUpdateDmemBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM][VDENC_BRC_NUM_OF_PASSES] = {};  //!< Brc Update DMEM Buffer Array.
-    PMOS_RESOURCE m_vdencBrcConstDataBuffer[CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM]                    = {};  //!< BRC Const Data Buffer for each frame type.
+    mutable PMOS_RESOURCE m_vdencBrcConstDataBuffer[CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM]            = {};  //!< BRC Const Data Buffer for each frame type, swapped on update when pooled.
+    mutable VdencAvcHucBrcConstantData m_vdencBrcConstData[CODECHAL_ENCODE_VDENC_BRC_CONST_BUFFER_NUM]     = {};  //!< CPU copy of BRC const data for each frame type.
+    EncodeConstBufferPool     *m_constBufferPool = nullptr;                                                      //!< Device wide pool, const data buffers are shared when set.
 
     PMOS_RESOURCE m_resPakOutputViaMmioBuffer = {};  //!< Buffer for PAK statistics output via MMIO
 
@@ -465,6 +465,24 @@ namespace encode
             activeBitstreamSize -= reservedPart;
         }
 
+        // Tile layout is seldom changed between frames, skip the per tile
+        // derivation below if none of its inputs changed.
+        m_newTileLayoutKey.clear();
+        m_newTileLayoutKey.push_back(m_numTileRows);
+        m_newTileLayoutKey.push_back(m_numTileColumns);
+        m_newTileLayoutKey.push_back(hevcSeqParams->wFrameWidthInMinCbMinus1);
+        m_newTileLayoutKey.push_back(hevcSeqParams->wFrameHeightInMinCbMinus1);
+        m_newTileLayoutKey.push_back(hevcSeqParams->log2_max_coding_block_size_minus3);
+        m_newTileLayoutKey.push_back(hevcSeqParams->log2_min_coding_block_size_minus3);
+        m_newTileLayoutKey.push_back((uint32_t)activeBitstreamSize);
+        m_newTileLayoutKey.push_back(((HevcBasicFeature *)m_basicFeature)->m_sizeOfSseSrcPixelRowStoreBufferPerLcu);
+        m_newTileLayoutKey.insert(m_newTileLayoutKey.end(), hevcPicParams->tile_column_width, hevcPicParams->tile_column_width + m_numTileColumns);
+        m_newTileLayoutKey.insert(m_newTileLayoutKey.end(), hevcPicParams->tile_row_height, hevcPicParams->tile_row_height + m_numTileRows);
+        if (!IsTileLayoutChanged())
+        {
+            return eStatus;
+        }
+
         for (uint32_t numLcusInTiles = 0, i = 0; i < m_numTileRows; i++)
         {
             for (uint32_t j = 0; j < m_numTileColumns; j++)
@@ -522,6 +540,8 @@ namespace encode
             sseRowstoreOffset = 0;
         }
 
+        CommitTileLayout();
+
         return eStatus;
     }
 
@@ -36,6 +36,7 @@ HevcVdencRoi::HevcVdencRoi(
     CodechalHwInterfaceNext *hwInterface,
     void *constSettings) :
     MediaFeature(constSettings, hwInterface ? hwInterface->GetOsInterface() : nullptr),
+    m_streamInUploader(allocator),
     m_allocator(allocator),
     m_hwInterface(hwInterface)
 {
@@ -49,18 +50,19 @@ HevcVdencRoi::HevcVdencRoi(
     m_basicFeature = dynamic_cast<EncodeBasicFeature *>(m_featureManager->GetFeature(FeatureIDs::basicFeature));
     ENCODE_CHK_NULL_NO_STATUS_RETURN(m_basicFeature);
 }
+
+HevcVdencRoi::~HevcVdencRoi()
+{
+    MOS_SafeFreeMemory(m_streamInTemp);
+    m_streamInTemp = nullptr;
+}
+
 MOS_STATUS HevcVdencRoi::ClearStreaminBuffer(uint32_t lucNumber)
 {
-    // Clear streamin
+    // Clear streamin staging only, the whole map is uploaded by WriteStreaminData
     ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
-    uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(data);
-
-    MOS_ZeroMemory(m_streamInTemp, lucNumber * 64);
-    MOS_SecureMemcpy(data, m_streamInSize, m_streamInTemp, m_streamInSize);
-
-    ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_streamIn));
+    MOS_ZeroMemory(m_streamInTemp, m_streamInSize);
 
     return MOS_STATUS_SUCCESS;
 }
@@ -178,11 +180,14 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     if (!m_isArbRoi || (hevcPicParams->CodingType == I_TYPE && !IFrameIsSet) || ((hevcPicParams->CodingType == P_TYPE || hevcPicParams->CodingType == B_TYPE) && !PBFrameIsSet))
     {
-        m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
-        ENCODE_CHK_NULL_RETURN(m_streamInTemp);
-
         uint32_t lcuNumber = GetLCUNumber();
 
+        if (m_streamInTemp == nullptr)
+        {
+            m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
+            ENCODE_CHK_NULL_RETURN(m_streamInTemp);
+        }
+
         ENCODE_CHK_STATUS_RETURN(ClearStreaminBuffer(lcuNumber));
 
         m_roiOverlap.Update(lcuNumber);
@@ -212,8 +217,6 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
         ENCODE_CHK_STATUS_RETURN(WriteStreaminData());
 
-        MOS_SafeFreeMemory(m_streamInTemp);
-
 #if (_DEBUG || _RELEASE_INTERNAL)
         ENCODE_CHK_NULL_RETURN(m_hwInterface);
         ENCODE_CHK_NULL_RETURN(m_hwInterface->GetOsInterface());
@@ -242,17 +245,15 @@ MOS_STATUS HevcVdencRoi::WriteStreaminData()
     ENCODE_CHK_NULL_RETURN(m_streamIn);
     ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
-    uint8_t *streaminBuffer = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(streaminBuffer);
-
     m_roiOverlap.WriteStreaminData(
         m_strategyFactory.GetRoi(), 
         m_strategyFactory.GetDirtyRoi(),
         m_streamInTemp);
 
-    MOS_SecureMemcpy(streaminBuffer, m_streamInSize, m_streamInTemp, m_streamInSize);
+    // One 64x64 LCU row of the zigzag stream-in layout per comparison unit
+    uint32_t rowSize = (MOS_ALIGN_CEIL(m_basicFeature->m_frameWidth, 64) / 32) * 2 * CODECHAL_CACHELINE_SIZE;
+    ENCODE_CHK_STATUS_RETURN(m_streamInUploader.Upload(m_streamIn, m_streamInTemp, m_streamInSize, rowSize));
 
-    m_allocator->UnLock(m_streamIn);
     return MOS_STATUS_SUCCESS;
 }
 
@@ -30,6 +30,7 @@
 #include "media_feature.h"
 #include "encode_hevc_vdenc_roi_overlap.h"
 #include "encode_hevc_vdenc_roi_strategy.h"
+#include "encode_stream_in_uploader.h"
 #include "encode_hevc_brc.h"
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_huc_itf.h"
@@ -63,7 +64,7 @@ public:
         CodechalHwInterfaceNext *hwInterface,
         void *constSettings);
 
-    virtual ~HevcVdencRoi() {}
+    virtual ~HevcVdencRoi();
 
     //!
     //! \brief  Init encode parameter
@@ -208,7 +209,7 @@ protected:
     }
 
     //!
-    //! \brief    ClearStreaminBuffer
+    //! \brief    Clear stream-in staging buffer
     //! \return   MOS_STATUS
     //!           MOS_STATUS_SUCCESS if success, else fail reason
     //!
@@ -247,8 +248,9 @@ protected:
     bool m_isArbRoiSupported = true;     //!< Whether is Adaptive Region Boost ROI Supported
 
     PMOS_RESOURCE      m_streamIn = nullptr; //!< Stream in buffer
-    uint8_t *          m_streamInTemp = nullptr;
+    uint8_t *          m_streamInTemp = nullptr; //!< Cached staging buffer of stream in, kept across frames
     uint32_t           m_streamInSize = 0;
+    EncodeStreamInUploader m_streamInUploader;   //!< Copies changed stream in rows to m_streamIn
     RoiStrategyFactory m_strategyFactory;    //!< Factory of strategy
     RoiOverlap         m_roiOverlap;         //!< ROI and dirty ROI overlap
 
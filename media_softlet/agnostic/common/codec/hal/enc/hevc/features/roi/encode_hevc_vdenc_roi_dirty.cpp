@@ -389,12 +389,8 @@ void DirtyROI::StreaminSetDirtyRectRegion(
 {
     ENCODE_FUNC_CALL();
 
-    std::vector<uint32_t> lcuVector;
-    GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
-
-    overlap.MarkLcus(lcuVector, cu64Align ? 
-        RoiOverlap::mkDirtyRoi : 
-        RoiOverlap::mkDirtyRoiNone64Align);
+    MarkLcusInRoiRegion(streamInWidth, top, bottom, left, right,
+        cu64Align ? RoiOverlap::mkDirtyRoi : RoiOverlap::mkDirtyRoiNone64Align, -1, overlap);
 }
 
 void DirtyROI::StreaminSetBorderNon64AlignStaticRegion(
@@ -407,13 +403,8 @@ void DirtyROI::StreaminSetBorderNon64AlignStaticRegion(
 {
     ENCODE_FUNC_CALL();
 
-    std::vector<uint32_t> lcuVector;
-    GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
-
-    for (uint32_t lcu : lcuVector)
-    {
-        overlap.MarkLcus(lcuVector, RoiOverlap::mkDirtyRoiBkNone64Align);
-    }
+    MarkLcusInRoiRegion(streamInWidth, top, bottom, left, right,
+        RoiOverlap::mkDirtyRoiBkNone64Align, -1, overlap);
 }
 
 void DirtyROI::SetStreaminBackgroundData(
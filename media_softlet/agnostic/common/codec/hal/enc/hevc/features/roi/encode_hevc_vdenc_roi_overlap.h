@@ -107,6 +107,19 @@ public:
     //!
     void MarkLcu(uint32_t lcu, OverlapMarker marker);
 
+    //!
+    //! \brief  mark the specific LCU with provided marker and region index
+    //!
+    //! \param  [in] lcus
+    //!         Index of LCU
+    //! \param  [in] marker
+    //!         overlap marker
+    //! \param  [in] roiRegionIndex
+    //!         Index of ROI region
+    //! \return void
+    //!
+    void MarkLcu(uint32_t lcu, OverlapMarker marker, int32_t roiRegionIndex);
+
     //!
     //! \brief  Write streamin data according to the overlap map
     //!
@@ -125,19 +138,6 @@ public:
         uint8_t *streaminBuffer);
 
 private:
-    //!
-    //! \brief  mark the specific LCU with provided marker and region index
-    //!
-    //! \param  [in] lcus
-    //!         Index of LCU
-    //! \param  [in] marker
-    //!         overlap marker
-    //! \param  [in] roiRegionIndex
-    //!         Index of ROI region
-    //! \return void
-    //!
-    void MarkLcu(uint32_t lcu, OverlapMarker marker, int32_t roiRegionIndex);
-
     //!
     //! \brief  Check whether the marker can be written to the specific LCU.
     //!
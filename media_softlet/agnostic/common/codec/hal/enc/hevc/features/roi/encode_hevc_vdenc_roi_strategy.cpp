@@ -195,11 +195,8 @@ MOS_STATUS RoiStrategy::SetupRoi(RoiOverlap &overlap)
         uint16_t right  = (uint16_t)
             CodecHal_Clip3(0, streamInWidth, m_roiRegions[i].Right);
 
-        UintVector lcuVector;
-        GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
-
-        overlap.MarkLcus(lcuVector, cu64Align ? 
-            RoiOverlap::mkRoi : RoiOverlap::mkRoiNone64Align, i);
+        MarkLcusInRoiRegion(streamInWidth, top, bottom, left, right,
+            cu64Align ? RoiOverlap::mkRoi : RoiOverlap::mkRoiNone64Align, i, overlap);
     }
 
     for (auto i = 0; i < streamInNumCUs; i++)
@@ -360,6 +357,57 @@ void RoiStrategy::GetLCUsInRoiRegion(
     }
 }
 
+static inline void MarkLcuInOverlap(
+    RoiOverlap               &overlap,
+    uint32_t                  lcu,
+    RoiOverlap::OverlapMarker marker,
+    int32_t                   roiRegionIndex)
+{
+    if (roiRegionIndex < 0)
+    {
+        overlap.MarkLcu(lcu, marker);
+    }
+    else
+    {
+        overlap.MarkLcu(lcu, marker, roiRegionIndex);
+    }
+}
+
+void RoiStrategy::MarkLcusInRoiRegion(
+    uint32_t                  streamInWidth,
+    uint32_t                  top,
+    uint32_t                  bottom,
+    uint32_t                  left,
+    uint32_t                  right,
+    RoiOverlap::OverlapMarker marker,
+    int32_t                   roiRegionIndex,
+    RoiOverlap               &overlap)
+{
+    ENCODE_FUNC_CALL();
+
+    if (m_isTileModeEnabled)
+    {
+        UintVector lcuVector;
+        GetLCUsInRoiRegion(streamInWidth, top, bottom, left, right, lcuVector);
+        for (uint32_t lcu : lcuVector)
+        {
+            MarkLcuInOverlap(overlap, lcu, marker, roiRegionIndex);
+        }
+        return;
+    }
+
+    for (auto y = top; y < bottom; y++)
+    {
+        for (auto x = left; x < right; x++)
+        {
+            uint32_t offset = 0, xyOffset = 0;
+            StreaminZigZagToLinearMap(streamInWidth, x, y, &offset, &xyOffset);
+
+            MarkLcuInOverlap(overlap, offset + xyOffset, marker, roiRegionIndex);
+        }
+    }
+}
+
 /*******************************************************
 
     Following is for RoiStrategyFactory
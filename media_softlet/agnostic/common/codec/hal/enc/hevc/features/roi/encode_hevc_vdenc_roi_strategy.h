@@ -412,6 +412,42 @@ protected:
         uint32_t    right,
         UintVector &lcuVector);
 
+    //!
+    //! \brief    Mark all LCUs in ROI region in overlap map
+    //!
+    //! \detail   Walks the rectangle directly instead of collecting LCU
+    //!           indexes in a vector first, tile mode still goes through
+    //!           GetLCUsInRoiRegion as LCU order depends on tile layout.
+    //!
+    //! \param    [in] streamInWidth
+    //!           StreamInWidth, location of top left corner
+    //! \param    [in] top
+    //!           top of the ROI region
+    //! \param    [in] bottom
+    //!           bottom of the ROI region
+    //! \param    [in] left
+    //!           left of the ROI region
+    //! \param    [in] right
+    //!           right of the ROI region
+    //! \param    [in] marker
+    //!           overlap marker
+    //! \param    [in] roiRegionIndex
+    //!           Index of ROI region, negative if LCUs don't belong to any region
+    //! \param    [in, out] overlap
+    //!           ROI overlap map
+    //!
+    //! \return   void
+    //!
+    void MarkLcusInRoiRegion(
+        uint32_t                  streamInWidth,
+        uint32_t                  top,
+        uint32_t                  bottom,
+        uint32_t                  left,
+        uint32_t                  right,
+        RoiOverlap::OverlapMarker marker,
+        int32_t                   roiRegionIndex,
+        RoiOverlap               &overlap);
+
     //!
     //! \brief    Setup stream-in data per region
     //!
@@ -853,7 +853,7 @@ namespace encode {
             uint32_t offset = tileReportData[i].bitstreamByteOffset * CODECHAL_CACHELINE_SIZE;
             uint32_t len    = tileStatusReport[i].Length;
 
-            MOS_SecureMemcpy(bufPtr, len, &bitstream[offset], len);
+            MOS_StreamingMemcpy(bufPtr, len, &bitstream[offset], len);
             bufPtr += len;
         }
 
@@ -0,0 +1,273 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_const_buffer_pool.cpp
+//! \brief    Implements the pool of read-only constant buffers shared by encode instances
+//!
+
+#include "encode_const_buffer_pool.h"
+#include "encode_utils.h"
+
+namespace encode
+{
+std::mutex                                EncodeConstBufferPool::m_poolsMutex;
+std::map<void *, EncodeConstBufferPool *> EncodeConstBufferPool::m_pools;
+
+// Unreferenced tables are kept for streams opened later with the same settings.
+static const uint32_t maxIdleCount = 16;
+
+EncodeConstBufferPool *EncodeConstBufferPool::Attach(PMOS_INTERFACE osInterface)
+{
+    if (osInterface == nullptr || osInterface->osStreamState == nullptr ||
+        osInterface->osStreamState->osDeviceContext == nullptr)
+    {
+        return nullptr;
+    }
+
+    void *device = osInterface->osStreamState->osDeviceContext;
+
+    std::lock_guard<std::mutex> lock(m_poolsMutex);
+
+    EncodeConstBufferPool *pool = nullptr;
+    auto                   it   = m_pools.find(device);
+    if (it == m_pools.end())
+    {
+        pool = MOS_New(EncodeConstBufferPool);
+        if (pool == nullptr)
+        {
+            return nullptr;
+        }
+        m_pools.insert(std::make_pair(device, pool));
+    }
+    else
+    {
+        pool = it->second;
+    }
+
+    std::lock_guard<std::mutex> poolLock(pool->m_mutex);
+    pool->m_refCount++;
+
+    return pool;
+}
+
+void EncodeConstBufferPool::Detach(EncodeConstBufferPool *pool, PMOS_INTERFACE osInterface)
+{
+    if (pool == nullptr || osInterface == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_poolsMutex);
+
+    bool lastUser = false;
+    {
+        std::lock_guard<std::mutex> poolLock(pool->m_mutex);
+        ENCODE_ASSERT(pool->m_refCount > 0);
+        pool->m_refCount--;
+        if (pool->m_refCount == 0)
+        {
+            // Device may be destroyed after the last encode instance goes away.
+            if (pool->m_idleCount != pool->m_entries.size())
+            {
+                ENCODE_ASSERTMESSAGE("%zu shared const buffers are not released before detach",
+                    pool->m_entries.size() - pool->m_idleCount);
+            }
+            while (!pool->m_entries.empty())
+            {
+                pool->FreeEntry(osInterface, pool->m_entries.begin());
+            }
+            lastUser = true;
+        }
+    }
+
+    if (lastUser)
+    {
+        for (auto it = m_pools.begin(); it != m_pools.end(); it++)
+        {
+            if (it->second == pool)
+            {
+                m_pools.erase(it);
+                break;
+            }
+        }
+        MOS_Delete(pool);
+    }
+}
+
+uint64_t EncodeConstBufferPool::Hash(const void *data, uint32_t size)
+{
+    // FNV-1a, only used to skip memcmp of tables which differ.
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint64_t       hash  = 0xcbf29ce484222325ull;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+PMOS_RESOURCE EncodeConstBufferPool::Acquire(
+    PMOS_INTERFACE     osInterface,
+    EncodeConstTableId tableId,
+    const void        *data,
+    uint32_t           size,
+    const char        *name)
+{
+    ENCODE_FUNC_CALL();
+
+    if (osInterface == nullptr || data == nullptr || size == 0)
+    {
+        return nullptr;
+    }
+
+    uint64_t hash = Hash(data, size);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto &entry : m_entries)
+    {
+        if (entry.tableId == tableId && entry.hash == hash && entry.data.size() == size &&
+            memcmp(entry.data.data(), data, size) == 0)
+        {
+            if (entry.refCount++ == 0)
+            {
+                m_idleCount--;
+            }
+            m_stats.shareCount++;
+            return &entry.resource;
+        }
+    }
+
+    m_entries.emplace_back();
+    Entry &entry   = m_entries.back();
+    entry.tableId  = tableId;
+    entry.hash     = hash;
+    entry.data.assign((const uint8_t *)data, (const uint8_t *)data + size);
+    entry.refCount = 1;
+    MOS_ZeroMemory(&entry.resource, sizeof(MOS_RESOURCE));
+
+    if (Upload(osInterface, entry, name) != MOS_STATUS_SUCCESS)
+    {
+        m_entries.pop_back();
+        return nullptr;
+    }
+
+    m_stats.allocCount++;
+    m_stats.bufferBytes += entry.allocSize;
+
+    return &entry.resource;
+}
+
+MOS_STATUS EncodeConstBufferPool::Upload(PMOS_INTERFACE osInterface, Entry &entry, const char *name)
+{
+    MOS_ALLOC_GFXRES_PARAMS allocParams;
+    MOS_ZeroMemory(&allocParams, sizeof(MOS_ALLOC_GFXRES_PARAMS));
+    allocParams.Type         = MOS_GFXRES_BUFFER;
+    allocParams.TileType     = MOS_TILE_LINEAR;
+    allocParams.Format       = Format_Buffer;
+    allocParams.dwBytes      = MOS_ALIGN_CEIL((uint32_t)entry.data.size(), MOS_PAGE_SIZE);
+    allocParams.pBufName     = name;
+    allocParams.ResUsageType = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_WRITE;
+    entry.allocSize          = allocParams.dwBytes;
+
+    ENCODE_CHK_STATUS_RETURN(osInterface->pfnAllocateResource(osInterface, &allocParams, &entry.resource));
+
+    MOS_LOCK_PARAMS lockFlags;
+    MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
+    lockFlags.WriteOnly = 1;
+
+    uint8_t *dst = (uint8_t *)osInterface->pfnLockResource(osInterface, &entry.resource, &lockFlags);
+    if (dst == nullptr)
+    {
+        osInterface->pfnFreeResource(osInterface, &entry.resource);
+        return MOS_STATUS_NULL_POINTER;
+    }
+
+    MOS_SecureMemcpy(dst, entry.allocSize, entry.data.data(), entry.data.size());
+    MOS_ZeroMemory(dst + entry.data.size(), entry.allocSize - entry.data.size());
+    osInterface->pfnUnlockResource(osInterface, &entry.resource);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void EncodeConstBufferPool::Release(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource)
+{
+    if (osInterface == nullptr || resource == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto &entry : m_entries)
+    {
+        if (&entry.resource == resource)
+        {
+            ENCODE_ASSERT(entry.refCount > 0);
+            if (--entry.refCount == 0)
+            {
+                m_idleCount++;
+                TrimIdle(osInterface, maxIdleCount);
+            }
+            return;
+        }
+    }
+
+    ENCODE_ASSERTMESSAGE("Buffer is not owned by const buffer pool");
+}
+
+EncodeConstBufferPool::Statistics EncodeConstBufferPool::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void EncodeConstBufferPool::FreeEntry(PMOS_INTERFACE osInterface, std::list<Entry>::iterator it)
+{
+    // Caller must hold m_mutex.
+    if (it->refCount == 0)
+    {
+        m_idleCount--;
+    }
+    osInterface->pfnFreeResource(osInterface, &it->resource);
+    m_stats.bufferBytes -= it->allocSize;
+    m_stats.freeCount++;
+    m_entries.erase(it);
+}
+
+void EncodeConstBufferPool::TrimIdle(PMOS_INTERFACE osInterface, uint32_t maxIdleCount)
+{
+    // Entries are in upload order, evict oldest idle tables first, caller must hold m_mutex.
+    auto it = m_entries.begin();
+    while (it != m_entries.end() && m_idleCount > maxIdleCount)
+    {
+        auto next = std::next(it);
+        if (it->refCount == 0)
+        {
+            FreeEntry(osInterface, it);
+        }
+        it = next;
+    }
+}
+
+}  // namespace encode
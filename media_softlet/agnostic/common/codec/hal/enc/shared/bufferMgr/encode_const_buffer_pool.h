@@ -0,0 +1,157 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_const_buffer_pool.h
+//! \brief    Defines the pool of read-only constant buffers shared by encode instances
+//! \details  HuC BRC constant data only depends on codec, platform and a few
+//!           sequence level parameters, so concurrent streams on the same
+//!           device end up uploading identical tables. The pool keeps one GPU
+//!           buffer per distinct table content per device and hands it out
+//!           ref counted. Buffers from the pool must never be written by
+//!           CPU or GPU after Acquire.
+//!
+
+#ifndef __ENCODE_CONST_BUFFER_POOL_H__
+#define __ENCODE_CONST_BUFFER_POOL_H__
+
+#include "mos_os.h"
+#include "media_class_trace.h"
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace encode
+{
+//!
+//! \brief  Identifies the table layout, tables of different id never share a buffer
+//!
+enum EncodeConstTableId
+{
+    encodeConstTableAvcHucBrcUpdate = 0,
+};
+
+class EncodeConstBufferPool
+{
+public:
+    EncodeConstBufferPool() {}
+    virtual ~EncodeConstBufferPool() {}
+
+    //!
+    //! \brief  Pool statistics
+    //!
+    struct Statistics
+    {
+        uint64_t allocCount  = 0;  //!< Buffers allocated and uploaded
+        uint64_t shareCount  = 0;  //!< Requests served by an existing buffer
+        uint64_t freeCount   = 0;  //!< Buffers returned to OS
+        uint64_t bufferBytes = 0;  //!< Bytes currently held by pool
+    };
+
+    //!
+    //! \brief  Attach to the pool of the device which osInterface belongs to
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \return EncodeConstBufferPool*
+    //!         Pointer to the device pool, nullptr if sharing is not supported
+    //!
+    static EncodeConstBufferPool *Attach(PMOS_INTERFACE osInterface);
+
+    //!
+    //! \brief  Detach from the device pool, buffers are freed by the last user
+    //! \param  [in] pool
+    //!         Pool returned by Attach
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \return void
+    //!
+    static void Detach(EncodeConstBufferPool *pool, PMOS_INTERFACE osInterface);
+
+    //!
+    //! \brief  Get read-only buffer holding the table, upload it if no buffer has the same content
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \param  [in] tableId
+    //!         Table layout
+    //! \param  [in] data
+    //!         Table content
+    //! \param  [in] size
+    //!         Table size in bytes
+    //! \param  [in] name
+    //!         Buffer name used on allocation
+    //! \return PMOS_RESOURCE
+    //!         Shared buffer, nullptr if fail
+    //!
+    PMOS_RESOURCE Acquire(
+        PMOS_INTERFACE     osInterface,
+        EncodeConstTableId tableId,
+        const void        *data,
+        uint32_t           size,
+        const char        *name);
+
+    //!
+    //! \brief  Drop one reference of buffer returned by Acquire
+    //! \param  [in] osInterface
+    //!         Pointer to MOS_INTERFACE
+    //! \param  [in] resource
+    //!         Buffer to be released
+    //! \return void
+    //!
+    void Release(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource);
+
+    //!
+    //! \brief  Get pool statistics
+    //! \return Statistics
+    //!
+    Statistics GetStatistics();
+
+protected:
+    struct Entry
+    {
+        EncodeConstTableId   tableId;
+        uint64_t             hash;
+        std::vector<uint8_t> data;
+        MOS_RESOURCE         resource;
+        uint32_t             allocSize;
+        uint32_t             refCount;
+    };
+
+    static uint64_t Hash(const void *data, uint32_t size);
+
+    MOS_STATUS Upload(PMOS_INTERFACE osInterface, Entry &entry, const char *name);
+    void       FreeEntry(PMOS_INTERFACE osInterface, std::list<Entry>::iterator it);
+    void       TrimIdle(PMOS_INTERFACE osInterface, uint32_t maxIdleCount);
+
+    std::mutex         m_mutex;
+    std::list<Entry>   m_entries;           //!< List keeps resource address stable for users
+    uint32_t           m_idleCount = 0;     //!< Entries with no reference, kept for stream churn
+    uint32_t           m_refCount  = 0;
+    Statistics         m_stats;
+
+    static std::mutex                                   m_poolsMutex;
+    static std::map<void *, EncodeConstBufferPool *>    m_pools;     //!< Pools indexed by device handle
+
+MEDIA_CLASS_DEFINE_END(encode__EncodeConstBufferPool)
+};
+
+}  // namespace encode
+#endif  // !__ENCODE_CONST_BUFFER_POOL_H__
@@ -0,0 +1,135 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_stream_in_uploader.cpp
+//! \brief    Implements the uploader of VDENC stream-in buffers
+//!
+
+#include "encode_stream_in_uploader.h"
+#include "encode_allocator.h"
+#include "encode_utils.h"
+
+namespace encode
+{
+EncodeStreamInUploader::~EncodeStreamInUploader()
+{
+    Reset();
+}
+
+void EncodeStreamInUploader::Reset()
+{
+    MOS_SafeFreeMemory(m_prevStaging);
+    m_prevStaging = nullptr;
+    m_size        = 0;
+    m_rowSize     = 0;
+    m_version     = 0;
+    m_rowVersion.clear();
+    m_resVersion.clear();
+}
+
+void EncodeStreamInUploader::UpdateRowVersions(const uint8_t *staging)
+{
+    uint32_t newVersion = m_version + 1;
+    bool     changed    = false;
+
+    for (uint32_t row = 0; row < m_rowVersion.size(); row++)
+    {
+        uint32_t offset = row * m_rowSize;
+        uint32_t size   = MOS_MIN(m_rowSize, m_size - offset);
+        if (m_rowVersion[row] == 0 || memcmp(m_prevStaging + offset, staging + offset, size) != 0)
+        {
+            MOS_SecureMemcpy(m_prevStaging + offset, size, staging + offset, size);
+            m_rowVersion[row] = newVersion;
+            changed           = true;
+        }
+    }
+
+    if (changed)
+    {
+        m_version = newVersion;
+    }
+}
+
+MOS_STATUS EncodeStreamInUploader::Upload(PMOS_RESOURCE resource, const uint8_t *staging, uint32_t size, uint32_t rowSize)
+{
+    ENCODE_FUNC_CALL();
+
+    ENCODE_CHK_NULL_RETURN(m_allocator);
+    ENCODE_CHK_NULL_RETURN(resource);
+    ENCODE_CHK_NULL_RETURN(staging);
+    ENCODE_CHK_COND_RETURN(size == 0 || rowSize == 0, "Invalid stream-in size");
+
+    if (size != m_size || rowSize != m_rowSize || m_version == UINT32_MAX)
+    {
+        Reset();
+        m_prevStaging = (uint8_t *)MOS_AllocMemory(size);
+        ENCODE_CHK_NULL_RETURN(m_prevStaging);
+        m_size    = size;
+        m_rowSize = rowSize;
+        m_rowVersion.assign(MOS_ROUNDUP_DIVIDE(size, rowSize), 0);
+    }
+
+    UpdateRowVersions(staging);
+
+    std::vector<uint32_t> &resVersion = m_resVersion[resource];
+    if (resVersion.size() != m_rowVersion.size())
+    {
+        resVersion.assign(m_rowVersion.size(), 0);
+    }
+
+    // Identical ROI set on a buffer which already holds it, nothing to write.
+    if (resVersion == m_rowVersion)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(resource);
+    ENCODE_CHK_NULL_RETURN(data);
+
+    // Coalesce adjacent stale rows into one copy, which keeps the writes to
+    // write-combined memory sequential.
+    uint32_t rowCount = (uint32_t)m_rowVersion.size();
+    uint32_t row      = 0;
+    while (row < rowCount)
+    {
+        if (resVersion[row] == m_rowVersion[row])
+        {
+            row++;
+            continue;
+        }
+
+        uint32_t first = row;
+        while (row < rowCount && resVersion[row] != m_rowVersion[row])
+        {
+            resVersion[row] = m_rowVersion[row];
+            row++;
+        }
+
+        uint32_t offset = first * m_rowSize;
+        uint32_t bytes  = MOS_MIN(row * m_rowSize, m_size) - offset;
+        MOS_SecureMemcpy(data + offset, bytes, m_prevStaging + offset, bytes);
+    }
+
+    return m_allocator->UnLock(resource);
+}
+
+}  // namespace encode
@@ -0,0 +1,104 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_stream_in_uploader.h
+//! \brief    Defines the uploader of VDENC stream-in buffers
+//! \details  Stream-in maps are built in a cached staging buffer and only
+//!           the rows which differ from the content already in the target
+//!           stream-in buffer are copied, so stable ROI sets cost no writes
+//!           to write-combined GPU memory at all.
+//!
+
+#ifndef __ENCODE_STREAM_IN_UPLOADER_H__
+#define __ENCODE_STREAM_IN_UPLOADER_H__
+
+#include "media_class_trace.h"
+#include "mos_defs.h"
+#include "mos_os.h"
+#include <map>
+#include <vector>
+
+namespace encode
+{
+class EncodeAllocator;
+
+class EncodeStreamInUploader
+{
+public:
+    //!
+    //! \brief  EncodeStreamInUploader constructor
+    //! \param  [in] allocator
+    //!         Pointer to EncodeAllocator
+    //!
+    EncodeStreamInUploader(EncodeAllocator *allocator) : m_allocator(allocator) {}
+
+    //!
+    //! \brief  EncodeStreamInUploader destructor
+    //!
+    virtual ~EncodeStreamInUploader();
+
+    //!
+    //! \brief  Copy rows of staging buffer which are stale in target resource
+    //! \details Rows are compared against the staging content of previous call,
+    //!          each changed row gets a new version, and a resource only takes
+    //!          rows whose version differs from the one it was last written with.
+    //!          Resource is not locked at all if it is up to date.
+    //! \param  [in] resource
+    //!         Target stream-in buffer, must not be written by anyone else
+    //! \param  [in] staging
+    //!         Staging buffer with complete stream-in map of current frame
+    //! \param  [in] size
+    //!         Size of staging buffer in bytes
+    //! \param  [in] rowSize
+    //!         Granularity of comparison and copy in bytes
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Upload(PMOS_RESOURCE resource, const uint8_t *staging, uint32_t size, uint32_t rowSize);
+
+    //!
+    //! \brief  Forget all tracked content
+    //! \details Must be called when target resources are reallocated.
+    //!
+    void Reset();
+
+protected:
+    //!
+    //! \brief  Update row versions by comparing staging with previous content
+    //! \param  [in] staging
+    //!         Staging buffer of current frame
+    //!
+    void UpdateRowVersions(const uint8_t *staging);
+
+    EncodeAllocator       *m_allocator   = nullptr;
+    uint8_t               *m_prevStaging = nullptr;  //!< Staging content of previous call
+    uint32_t               m_size        = 0;
+    uint32_t               m_rowSize     = 0;
+    uint32_t               m_version     = 0;        //!< Latest row version, 0 means never uploaded
+    std::vector<uint32_t>  m_rowVersion;             //!< Version of each row in m_prevStaging
+    std::map<PMOS_RESOURCE, std::vector<uint32_t>> m_resVersion;  //!< Version of each row in resource
+
+MEDIA_CLASS_DEFINE_END(encode__EncodeStreamInUploader)
+};
+
+}  // namespace encode
+#endif  // !__ENCODE_STREAM_IN_UPLOADER_H__
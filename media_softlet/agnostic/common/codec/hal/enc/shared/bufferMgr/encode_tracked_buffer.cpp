@@ -34,15 +34,35 @@
 
 namespace encode {
 constexpr MapBufferResourceType TrackedBuffer::m_mapBufferResourceType[];
+constexpr uint32_t              TrackedBuffer::m_bufferTypeCount;
+constexpr uint8_t               TrackedBuffer::m_invalidSlot;
+constexpr uint8_t               TrackedBuffer::m_maxSupportedSlot;
+constexpr uint32_t              TrackedBuffer::m_waitTimeoutMs;
+
 TrackedBuffer::TrackedBuffer(EncodeAllocator *allocator, uint8_t maxRefCnt, uint8_t maxNonRefCnt)
     : m_maxRefSlotCnt(maxRefCnt),
       m_maxNonRefSlotCnt(maxNonRefCnt),
       m_allocator(allocator)
 {
     m_maxSlotCnt = m_maxRefSlotCnt + m_maxNonRefSlotCnt;
+    if (m_maxSlotCnt > m_maxSupportedSlot)
+    {
+        ENCODE_ASSERTMESSAGE("Slot count %d exceeds %d", m_maxSlotCnt, m_maxSupportedSlot);
+        m_maxSlotCnt = m_maxSupportedSlot;
+    }
+
     for (uint8_t i = 0; i < m_maxSlotCnt; i++)
     {
-        m_bufferSlots.push_back(MOS_New(BufferSlot, this));
+        m_bufferSlots.push_back(MOS_New(BufferSlot, this, i));
+    }
+
+    for (uint32_t i = 0; i < m_bufferTypeCount; i++)
+    {
+        m_resourceTypes[i] = ResourceType::invalidResource;
+    }
+    for (auto pair : m_mapBufferResourceType)
+    {
+        m_resourceTypes[static_cast<uint32_t>(pair.buffer)] = pair.type;
     }
 
     m_mutex = MosUtilities::MosCreateMutex();
@@ -50,12 +70,25 @@ TrackedBuffer::TrackedBuffer(EncodeAllocator *allocator, uint8_t maxRefCnt, uint
 
 TrackedBuffer::~TrackedBuffer()
 {
+    if (m_waitCount.load() > 0)
+    {
+        ENCODE_NORMALMESSAGE("Tracked buffer waited %llu times in %llu acquires, %llu us in total, %llu us at most, %llu timeouts",
+            (unsigned long long)m_waitCount.load(),
+            (unsigned long long)m_acquireCount.load(),
+            (unsigned long long)m_totalWaitUs.load(),
+            (unsigned long long)m_maxWaitUs.load(),
+            (unsigned long long)m_timeoutCount.load());
+    }
+
     for (auto it = m_bufferSlots.begin(); it != m_bufferSlots.end(); it++)
     {
         (*it)->Reset();
         MOS_Delete(*it);
     }
-    m_bufferQueue.clear();
+    for (uint32_t i = 0; i < m_bufferTypeCount; i++)
+    {
+        m_bufferQueue[i] = nullptr;
+    }
     m_oldQueue.clear();
 
     MosUtilities::MosDestroyMutex(m_mutex);
@@ -63,17 +96,13 @@ TrackedBuffer::~TrackedBuffer()
 
 MOS_STATUS TrackedBuffer::RegisterParam(BufferType type, MOS_ALLOC_GFXRES_PARAMS param)
 {
-    auto iter = m_allocParams.find(type);
-    if (iter == m_allocParams.end())
-    {
-        m_allocParams.emplace(type, param);
-    }
-    else
-    {
-        // erase the older param and insert new one when resultion change happens
-        m_allocParams.erase(iter);
-        m_allocParams.insert(std::make_pair(type, param));
-    }
+    uint32_t index = static_cast<uint32_t>(type);
+    ENCODE_CHK_COND_RETURN(index >= m_bufferTypeCount, "Invalid buffer type %d", index);
+
+    // the older param is replaced when resultion change happens
+    m_allocParams[index]     = param;
+    m_allocParamValid[index] = true;
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -123,57 +152,117 @@ MOS_STATUS TrackedBuffer::ReleaseUnusedSlots(
     
 }
 
-MOS_STATUS TrackedBuffer::Acquire(
-    CODEC_REF_LIST* refList,
-    bool isIdrFrame,
-    bool lazyRelease)
+uint8_t TrackedBuffer::ClaimFreeSlot()
 {
-    ENCODE_CHK_NULL_RETURN(refList);
-    AutoLock lock(m_mutex);
+    uint64_t allSlots = (m_maxSlotCnt >= 64) ? ~0ull : ((1ull << m_maxSlotCnt) - 1);
+    uint64_t busy     = m_busyMask.load();
 
-    //if encouter Idr frame, need to clear the reference slots
-    if (isIdrFrame)
+    while ((busy & allSlots) != allSlots)
     {
-        for (auto it = m_bufferSlots.begin(); it != m_bufferSlots.end(); it++)
+        // lowest clear bit
+        uint64_t bit = ~busy & (busy + 1);
+        if (m_busyMask.compare_exchange_weak(busy, busy | bit))
         {
-            (*it)->Reset();
+            uint8_t index = 0;
+            while ((bit >> index) != 1)
+            {
+                index++;
+            }
+            return index;
         }
     }
 
-    ENCODE_CHK_STATUS_RETURN(ReleaseUnusedSlots(refList, lazyRelease));
+    return m_invalidSlot;
+}
 
-    // get current free slot index
-    refList->ucScalingIdx = m_currSlotIndex = 0XFF;
-    for (uint8_t i = 0; i < m_maxSlotCnt; i++)
+uint8_t TrackedBuffer::WaitForFreeSlot()
+{
+    m_waitCount++;
+
+    // Register as waiter and retry under m_mutex, Release checks the waiter
+    // count under the same lock so a slot handed back in between is either
+    // claimed here or followed by a post on m_condition.
+    double  start = MosUtilities::MosGetTime();
+    uint8_t index = m_invalidSlot;
+    {
+        AutoLock lock(m_mutex);
+        m_waiterCount++;
+        index = ClaimFreeSlot();
+    }
+
+    while (index == m_invalidSlot)
     {
-        BufferSlot *slot = m_bufferSlots[i];
-        if (slot->IsFree())
+        double   elapsed = MosUtilities::MosGetTime() - start;
+        uint32_t leftMs  = (uint32_t)(m_waitTimeoutMs - MOS_MIN(elapsed / 1000, (double)m_waitTimeoutMs));
+        if (leftMs == 0 || m_condition.Wait(leftMs) != MOS_STATUS_SUCCESS)
         {
-            m_currSlotIndex = i;
-            slot->SetBusy();
-            slot->SetFrameIdx(refList->RefPic.FrameIdx);
+            index = ClaimFreeSlot();
+            if (index == m_invalidSlot)
+            {
+                m_timeoutCount++;
+            }
             break;
         }
+        index = ClaimFreeSlot();
     }
-    
-    //if not found, wait for previous slot returned
-    if (m_currSlotIndex == 0XFF)
+
+    {
+        AutoLock lock(m_mutex);
+        m_waiterCount--;
+    }
+
+    uint64_t waitUs = (uint64_t)(MosUtilities::MosGetTime() - start);
+    m_totalWaitUs += waitUs;
+    uint64_t maxWaitUs = m_maxWaitUs.load();
+    while (waitUs > maxWaitUs && !m_maxWaitUs.compare_exchange_weak(maxWaitUs, waitUs))
+    {
+    }
+
+    return index;
+}
+
+MOS_STATUS TrackedBuffer::Acquire(
+    CODEC_REF_LIST* refList,
+    bool isIdrFrame,
+    bool lazyRelease)
+{
+    ENCODE_CHK_NULL_RETURN(refList);
+    m_acquireCount++;
+
     {
-        MOS_STATUS status = m_condition.Wait(m_mutex);
-        if (status != MOS_STATUS_SUCCESS || m_currSlotIndex == 0XFF)
+        AutoLock lock(m_mutex);
+
+        //if encouter Idr frame, need to clear the reference slots
+        if (isIdrFrame)
         {
-            return MOS_STATUS_UNKNOWN;
+            for (auto it = m_bufferSlots.begin(); it != m_bufferSlots.end(); it++)
+            {
+                (*it)->Reset();
+            }
         }
 
-        ENCODE_ASSERT(m_currSlotIndex != 0XFF);
+        ENCODE_CHK_STATUS_RETURN(ReleaseUnusedSlots(refList, lazyRelease));
+    }
+
+    // get current free slot index
+    refList->ucScalingIdx = m_currSlotIndex = m_invalidSlot;
+    uint8_t slotIndex = ClaimFreeSlot();
 
-        BufferSlot *slot = m_bufferSlots[m_currSlotIndex];
-        ENCODE_CHK_NULL_RETURN(slot);
-        slot->SetBusy();
-        slot->SetFrameIdx(refList->RefPic.FrameIdx);
+    //if not found, wait for previous slot returned
+    if (slotIndex == m_invalidSlot)
+    {
+        slotIndex = WaitForFreeSlot();
+        if (slotIndex == m_invalidSlot)
+        {
+            return MOS_STATUS_UNKNOWN;
+        }
     }
 
-    refList->ucScalingIdx = m_currSlotIndex;
+    BufferSlot *slot = m_bufferSlots[slotIndex];
+    ENCODE_CHK_NULL_RETURN(slot);
+    slot->SetFrameIdx(refList->RefPic.FrameIdx);
+
+    refList->ucScalingIdx = m_currSlotIndex = slotIndex;
 
     return MOS_STATUS_SUCCESS;
 }
@@ -181,7 +270,6 @@ MOS_STATUS TrackedBuffer::Acquire(
 MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
 {
     ENCODE_CHK_NULL_RETURN(refList);
-    AutoLock lock(m_mutex);
 
     uint8_t slotIndex = refList->ucScalingIdx;
     if (slotIndex >= m_maxSlotCnt)
@@ -189,54 +277,55 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
         return MOS_STATUS_SUCCESS;
     }
 
-    //if the condition variable is waiting, assign the returned slot to m_currSlotIndex
-    //and signal the waiting condition
-    if (m_currSlotIndex == 0XFF && !refList->bUsedAsRef)
+    //if an acquire is waiting, hand the returned slot over and wake it up
+    if (!refList->bUsedAsRef)
     {
-        ENCODE_CHK_STATUS_RETURN(m_bufferSlots[slotIndex]->Reset());
-
-        m_currSlotIndex = slotIndex;
-        m_condition.Signal();
+        AutoLock lock(m_mutex);
+        if (m_waiterCount > 0)
+        {
+            ENCODE_CHK_STATUS_RETURN(m_bufferSlots[slotIndex]->Reset());
+            m_condition.Signal();
+        }
     }
 
-    if (!m_oldQueue.empty())
+    if (m_hasOldQueue.load())
     {
-        for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
-        {
-            if (iter->second->SafeToDestory())
-            {
-                iter = m_oldQueue.erase(iter);
-            }
-            else
-            {
-                iter++;
-            }
-        }
+        AutoLock lock(m_mutex);
+        DestroyIdleOldQueues();
     }
 
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS TrackedBuffer::OnSizeChange()
+void TrackedBuffer::DestroyIdleOldQueues()
 {
-    for (auto iter = m_bufferQueue.begin(); iter != m_bufferQueue.end();)
+    for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
     {
-        if (iter->second->SafeToDestory())
+        if ((*iter)->SafeToDestory())
         {
-            iter = m_bufferQueue.erase(iter);
+            iter = m_oldQueue.erase(iter);
         }
         else
         {
             iter++;
         }
     }
+    m_hasOldQueue.store(!m_oldQueue.empty());
+}
+
+MOS_STATUS TrackedBuffer::OnSizeChange()
+{
+    AutoLock lock(m_mutex);
 
-    if (!m_bufferQueue.empty())
+    for (uint32_t i = 0; i < m_bufferTypeCount; i++)
     {
-        m_oldQueue.insert(std::make_move_iterator(m_bufferQueue.begin()),
-            std::make_move_iterator(m_bufferQueue.end()));
-        m_bufferQueue.clear();
+        if (m_bufferQueue[i] != nullptr && !m_bufferQueue[i]->SafeToDestory())
+        {
+            m_oldQueue.push_back(m_bufferQueue[i]);
+        }
+        m_bufferQueue[i] = nullptr;
     }
+    m_hasOldQueue.store(!m_oldQueue.empty());
 
     return MOS_STATUS_SUCCESS;
 }
@@ -245,7 +334,7 @@ MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
 {
     ResourceType resType = GetResourceType(type);
 
-    if (index > m_maxSlotCnt || resType != ResourceType::surfaceResource)
+    if (index >= m_maxSlotCnt || resType != ResourceType::surfaceResource)
     {
         return nullptr;
     }
@@ -256,7 +345,7 @@ MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
 MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
 {
     ResourceType resType = GetResourceType(type);
-    if (index > m_maxSlotCnt || resType != ResourceType::bufferResource)
+    if (index >= m_maxSlotCnt || resType != ResourceType::bufferResource)
     {
         return nullptr;
     }
@@ -264,28 +353,38 @@ MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
     return (MOS_RESOURCE *)m_bufferSlots[index]->GetResource(type);
 }
 
+TrackedBuffer::WaitStatistics TrackedBuffer::GetWaitStatistics() const
+{
+    WaitStatistics stats;
+    stats.acquireCount = m_acquireCount.load();
+    stats.waitCount    = m_waitCount.load();
+    stats.timeoutCount = m_timeoutCount.load();
+    stats.totalWaitUs  = m_totalWaitUs.load();
+    stats.maxWaitUs    = m_maxWaitUs.load();
+    return stats;
+}
+
 std::shared_ptr<BufferQueue> TrackedBuffer::GetBufferQueue(BufferType type)
 {
-    auto iter = m_bufferQueue.find(type);
-    if (iter == m_bufferQueue.end())
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= m_bufferTypeCount)
+    {
+        return nullptr;
+    }
+
+    if (m_bufferQueue[index] == nullptr)
     {
-        auto param = m_allocParams.find(type);
-        if (param == m_allocParams.end())
+        if (!m_allocParamValid[index])
         {
             return nullptr;
         }
 
-        ResourceType resType = GetResourceType(type);
-
-        auto alloc = std::make_shared<BufferQueue>(m_allocator, param->second, m_maxSlotCnt);
-        alloc->SetResourceType(resType);
-        m_bufferQueue.emplace(type, alloc);
-        return alloc;
-    }
-    else
-    {
-        return iter->second;
+        auto alloc = std::make_shared<BufferQueue>(m_allocator, m_allocParams[index], m_maxSlotCnt);
+        alloc->SetResourceType(m_resourceTypes[index]);
+        m_bufferQueue[index] = alloc;
     }
+
+    return m_bufferQueue[index];
 }
 
 }
\ No newline at end of file
@@ -37,7 +37,7 @@
 #include "mos_os.h"
 #include "mos_os_specific.h"
 #include <stdint.h>
-#include <map>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -70,6 +70,7 @@ enum class BufferType
     preencRef0,
     preencRef1,
     AlignedRawSurface,
+    bufferTypeCount,    //!< Number of buffer types, not a valid type
 };
 
 struct MapBufferResourceType
@@ -83,6 +84,18 @@ class BufferSlot;
 class TrackedBuffer
 {
 public:
+    //!
+    //! \brief  Statistics of waiting for a free slot in Acquire
+    //!
+    struct WaitStatistics
+    {
+        uint64_t acquireCount = 0;  //!< Number of Acquire calls
+        uint64_t waitCount    = 0;  //!< Acquire calls which found no free slot
+        uint64_t timeoutCount = 0;  //!< Waits which timed out
+        uint64_t totalWaitUs  = 0;  //!< Total time spent waiting
+        uint64_t maxWaitUs    = 0;  //!< Longest single wait
+    };
+
     //!
     //! \brief  Constructor
     //! \param  [in] osInterface
@@ -173,6 +186,12 @@ public:
     //!
     virtual MOS_RESOURCE *GetBuffer(BufferType type, uint32_t index);
 
+    //!
+    //! \brief  Get statistics of waiting for free slots
+    //! \return WaitStatistics
+    //!
+    WaitStatistics GetWaitStatistics() const;
+
 protected:
     //!
     //! \brief  Get Resource type according to the buffer type
@@ -183,17 +202,29 @@ protected:
     //!
     ResourceType GetResourceType(BufferType buffer)
     {
-        for (auto pair : m_mapBufferResourceType)
-        {
-            if (pair.buffer == buffer)
-            {
-                return pair.type;
-            }
-        }
-
-        return ResourceType::invalidResource;
+        uint32_t index = static_cast<uint32_t>(buffer);
+        return index < m_bufferTypeCount ? m_resourceTypes[index] : ResourceType::invalidResource;
     }
 
+    //!
+    //! \brief  Claim lowest free slot without blocking
+    //! \return uint8_t
+    //!         Slot index, m_invalidSlot if all slots are busy
+    //!
+    uint8_t ClaimFreeSlot();
+
+    //!
+    //! \brief  Wait until a slot is handed back by Release and claim it
+    //! \return uint8_t
+    //!         Slot index, m_invalidSlot if timed out
+    //!
+    uint8_t WaitForFreeSlot();
+
+    //!
+    //! \brief  Destroy old queues whose buffers are all returned, caller holds m_mutex
+    //!
+    void DestroyIdleOldQueues();
+
     //!
     //! \brief  Reset the unused slots then can use them for other frames
     //! \param  [in]refList
@@ -211,6 +242,11 @@ protected:
     //!         shared_ptr<BufferQueue> if success, else nullptr
     std::shared_ptr<BufferQueue> GetBufferQueue(BufferType type);
 
+    static constexpr uint32_t m_bufferTypeCount  = static_cast<uint32_t>(BufferType::bufferTypeCount);
+    static constexpr uint8_t  m_invalidSlot      = 0xFF;
+    static constexpr uint8_t  m_maxSupportedSlot = 64;    //!< Slots are tracked in a 64 bits mask
+    static constexpr uint32_t m_waitTimeoutMs    = 5000;
+
     static constexpr MapBufferResourceType m_mapBufferResourceType[] =
     {
         {BufferType::mbCodedBuffer,             ResourceType::bufferResource},
@@ -240,14 +276,26 @@ protected:
     uint8_t m_maxNonRefSlotCnt  = 0;     //!< max non-reference slot count int he tracked buffer
     uint8_t m_currSlotIndex     = 0;     //!< current free slot index
 
-    PMOS_MUTEX                m_mutex;                //!< mutex
-    Condition                 m_condition;            //!< condition
+    PMOS_MUTEX                m_mutex;                //!< Serializes slot reset and old queue destroy, not taken to claim a slot
+    Condition                 m_condition;            //!< Posted when Release hands a slot to a waiting Acquire
     EncodeAllocator *         m_allocator = nullptr;  //!< encoder allocator
     std::vector<BufferSlot *> m_bufferSlots = {};          //!< buffer slots
 
-    std::map<BufferType, MOS_ALLOC_GFXRES_PARAMS>       m_allocParams = {};  //!< allocate parameters
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueue = {};  //!< buffer queues
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};     //!< old queues for resolution change
+    std::atomic<uint64_t>     m_busyMask{0};          //!< Bit i set if slot i is in use
+    uint32_t                  m_waiterCount = 0;      //!< Acquire calls waiting for a slot, guarded by m_mutex
+    std::atomic<bool>         m_hasOldQueue{false};   //!< m_oldQueue is not empty
+
+    std::atomic<uint64_t>     m_acquireCount{0};
+    std::atomic<uint64_t>     m_waitCount{0};
+    std::atomic<uint64_t>     m_timeoutCount{0};
+    std::atomic<uint64_t>     m_totalWaitUs{0};
+    std::atomic<uint64_t>     m_maxWaitUs{0};
+
+    ResourceType                 m_resourceTypes[m_bufferTypeCount]   = {};     //!< resource type per buffer type
+    MOS_ALLOC_GFXRES_PARAMS      m_allocParams[m_bufferTypeCount]     = {};     //!< allocate parameters
+    bool                         m_allocParamValid[m_bufferTypeCount] = {};     //!< allocate parameter is registered
+    std::shared_ptr<BufferQueue> m_bufferQueue[m_bufferTypeCount]     = {};     //!< buffer queues
+    std::vector<std::shared_ptr<BufferQueue>> m_oldQueue              = {};     //!< old queues for resolution change
 
 MEDIA_CLASS_DEFINE_END(encode__TrackedBuffer)
 };
@@ -30,32 +30,35 @@
 
 namespace encode {
 
-BufferSlot::BufferSlot(TrackedBuffer* tracker) :
-    m_tracker(tracker)
+BufferSlot::BufferSlot(TrackedBuffer* tracker, uint8_t index) :
+    m_tracker(tracker),
+    m_index(index)
 {
 }
 
 BufferSlot::~BufferSlot()
 {
-    for (auto iter = m_buffers.begin(); iter != m_buffers.end(); iter++)
+    ReleaseBuffers();
+}
+
+void BufferSlot::ReleaseBuffers()
+{
+    for (uint32_t i = 0; i < TrackedBuffer::m_bufferTypeCount; i++)
     {
-        std::shared_ptr<BufferQueue> queue = m_bufferQueues[iter->first];
-        queue->ReleaseResource(iter->second);
+        if (m_bufferQueues[i] != nullptr)
+        {
+            m_bufferQueues[i]->ReleaseResource(m_buffers[i]);
+            m_bufferQueues[i] = nullptr;
+        }
+        m_buffers[i] = nullptr;
     }
-    m_buffers.clear();
-    m_bufferQueues.clear();
 }
 
 MOS_STATUS BufferSlot::Reset()
 {
-    m_isBusy = false;
-    for (auto iter = m_buffers.begin(); iter != m_buffers.end(); iter++)
-    {
-        std::shared_ptr<BufferQueue> queue = m_bufferQueues[iter->first];
-        queue->ReleaseResource(iter->second);
-    }
-    m_buffers.clear();
-    m_bufferQueues.clear();
+    // Buffers go back to queues before the slot can be claimed again.
+    ReleaseBuffers();
+    m_tracker->m_busyMask.fetch_and(~(1ull << m_index));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -68,11 +71,16 @@ void *BufferSlot::GetResource(BufferType type)
         return nullptr;
     }
 
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= TrackedBuffer::m_bufferTypeCount)
+    {
+        return nullptr;
+    }
+
     // if surface already in the pool, return it directly
-    auto iter = m_buffers.find(type);
-    if (iter != m_buffers.end())
+    if (m_bufferQueues[index] != nullptr)
     {
-        return iter->second;
+        return m_buffers[index];
     }
 
     std::shared_ptr<BufferQueue> queue = m_tracker->GetBufferQueue(type);
@@ -81,11 +89,10 @@ void *BufferSlot::GetResource(BufferType type)
         return nullptr;
     }
 
-    void* resource = queue->AcquireResource();
     // record the surface acquired, only one surface for each type should be kept in the slot
-    m_buffers.insert(std::make_pair(type, resource));
-    m_bufferQueues.insert(std::make_pair(type, queue));
-    return resource;
+    m_buffers[index]      = queue->AcquireResource();
+    m_bufferQueues[index] = queue;
+    return m_buffers[index];
 }
 
 }
\ No newline at end of file
@@ -31,7 +31,6 @@
 #include "media_class_trace.h"
 #include "mos_defs.h"
 #include <stdint.h>
-#include <map>
 #include <memory>
 
 namespace encode {
@@ -44,8 +43,10 @@ public:
     //! \brief  Constructor
     //! \param  [in] tracker
     //!         pointer to BufferTracker
+    //! \param  [in] index
+    //!         index of the slot in tracker
     //!
-    BufferSlot(TrackedBuffer* tracker);
+    BufferSlot(TrackedBuffer* tracker, uint8_t index);
 
     //!
     //! \brief  Destructor
@@ -58,7 +59,7 @@ public:
     //!
     void SetBusy()
     {
-        m_isBusy = true;
+        m_tracker->m_busyMask.fetch_or(1ull << m_index);
     }
 
     //!
@@ -68,7 +69,7 @@ public:
     //!
     bool IsFree() const
     {
-        return !m_isBusy;
+        return (m_tracker->m_busyMask.load() & (1ull << m_index)) == 0;
     }
 
     //!
@@ -103,12 +104,17 @@ public:
     void *GetResource(BufferType type);
 
 protected:
+    //!
+    //! \brief  Return all buffers to their queues
+    //!
+    void ReleaseBuffers();
+
     uint8_t        m_frameIndex = 0;       //!< frame index associated with current slot
     TrackedBuffer *m_tracker  = nullptr;   //!< pointer to TrackedBuffer
-    bool           m_isBusy   = false;     //!< whether the slot is been using
+    uint8_t        m_index    = 0;         //!< bit of the slot in busy mask of tracker
 
-    std::map<BufferType, void *>                        m_buffers      = {};  //!< buffers attached with current slot
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueues = {};  //!< buffer queue for all types
+    void                        *m_buffers[TrackedBuffer::m_bufferTypeCount]      = {};  //!< buffers attached with current slot
+    std::shared_ptr<BufferQueue> m_bufferQueues[TrackedBuffer::m_bufferTypeCount] = {};  //!< buffer queue for all types
 
 MEDIA_CLASS_DEFINE_END(encode__BufferSlot)
 };
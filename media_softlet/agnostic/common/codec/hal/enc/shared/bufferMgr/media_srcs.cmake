@@ -26,6 +26,8 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_queue.cpp
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_slot.cpp
     ${CMAKE_CURRENT_LIST_DIR}/encode_allocator.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/encode_stream_in_uploader.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/encode_const_buffer_pool.cpp
 )
 
 set(TMP_HEADERS_
@@ -35,6 +37,8 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_queue.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_tracked_buffer_slot.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_allocator.h
+    ${CMAKE_CURRENT_LIST_DIR}/encode_stream_in_uploader.h
+    ${CMAKE_CURRENT_LIST_DIR}/encode_const_buffer_pool.h
 )
 
 set(SOFTLET_ENCODE_COMMON_HEADERS_
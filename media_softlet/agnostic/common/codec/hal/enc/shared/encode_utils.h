@@ -142,6 +142,10 @@ public:
         MosUtilities::MosLockMutex(mutex);
         return status;
     }
+    MOS_STATUS Wait(uint32_t milliseconds)
+    {
+        return MosUtilities::MosWaitSemaphore(m_sem, milliseconds);
+    }
     MOS_STATUS Signal()
     {
         MosUtilities::MosPostSemaphore(m_sem, 1);
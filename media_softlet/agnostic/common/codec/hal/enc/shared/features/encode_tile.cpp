@@ -118,6 +118,7 @@ namespace encode
             }
             m_tileData = nullptr;
             m_maxTileNumberUsed = m_maxTileNumber;
+            m_tileLayoutValid   = false;
         }
 
         // create the tile data parameters
@@ -595,4 +596,22 @@ namespace encode
 
         return MOS_STATUS_SUCCESS;
     }
+
+    bool EncodeTile::IsTileLayoutChanged()
+    {
+        if (m_tileLayoutValid && m_newTileLayoutKey == m_tileLayoutKey)
+        {
+            return false;
+        }
+
+        // Derivation may fail halfway, keep it invalid until CommitTileLayout.
+        m_tileLayoutValid = false;
+        return true;
+    }
+
+    void EncodeTile::CommitTileLayout()
+    {
+        m_tileLayoutKey.swap(m_newTileLayoutKey);
+        m_tileLayoutValid = true;
+    }
 }  // namespace encode
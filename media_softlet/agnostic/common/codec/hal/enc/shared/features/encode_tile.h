@@ -26,6 +26,7 @@
 #ifndef __ENCODE_TILE_H__
 #define __ENCODE_TILE_H__
 #include <array>
+#include <vector>
 
 #include "encode_basic_feature.h"
 #include "encode_pipeline.h"
@@ -485,6 +486,23 @@ protected:
     //!
     virtual MOS_STATUS AllocateTileStatistics(void *params) = 0;
 
+    //!
+    //! \brief    Check if tile data needs to be derived again
+    //! \details  Tile data only depends on frame size, tile partition and a few
+    //!           sequence level values, which seldom change between frames.
+    //!           Derived class fills m_newTileLayoutKey with all values its per
+    //!           tile derivation reads, then skips the derivation when the key
+    //!           matches the one m_tileData was derived from.
+    //! \return   bool
+    //!           true if m_tileData is out of date
+    //!
+    bool IsTileLayoutChanged();
+
+    //!
+    //! \brief    Record m_newTileLayoutKey as the key of current m_tileData
+    //!
+    void CommitTileLayout();
+
     EncodeAllocator          *m_allocator         = nullptr;  //!< Allocator used in tile feature
     EncodeBasicFeature       *m_basicFeature      = nullptr;  //!< EncodeBasicFeature
     CodechalHwInterfaceNext  *m_hwInterface       = nullptr;  //!< Hw interface as utilities
@@ -499,6 +517,10 @@ protected:
     uint16_t              m_numTileRows       = 1;        //!< Total number of tile rows
     uint16_t              m_numTileColumns    = 1;        //!< Total number of tile columns
 
+    std::vector<uint32_t> m_tileLayoutKey;                //!< Values current m_tileData is derived from
+    std::vector<uint32_t> m_newTileLayoutKey;             //!< Values of current frame, kept to reuse its storage
+    bool                  m_tileLayoutValid   = false;    //!< Whether m_tileLayoutKey matches m_tileData
+
     //MOS_RESOURCE      m_vdencTileRowStoreBuffer;         //!< Tile row store buffer
     //MOS_RESOURCE      m_vdencPaletteModeStreamOutBuffer; //!< Palette mode stream out buffer
     //MOS_RESOURCE      m_resHwCountTileReplay;            //!< Tile based HW Counter buffer
@@ -27,6 +27,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/mhw_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/mhw_hwcmd_process_cmdfields.h
     ${CMAKE_CURRENT_LIST_DIR}/mhw_utilities_next.h
+    ${CMAKE_CURRENT_LIST_DIR}/mhw_avs_coef_cache.h
 )
 
 set(SOFTLET_MHW_COMMON_HEADERS_
@@ -107,6 +108,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/mhw_memory_pool.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mhw_blt.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mhw_utilities_next.cpp  
+    ${CMAKE_CURRENT_LIST_DIR}/mhw_avs_coef_cache.cpp
 )
 
 set(SOFTLET_MHW_COMMON_SOURCES_
@@ -0,0 +1,191 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mhw_avs_coef_cache.cpp
+//! \brief    Implements process wide cache of AVS polyphase coefficient tables
+//!
+
+#include <new>
+#include <string.h>
+#include "mhw_avs_coef_cache.h"
+#include "mos_utilities.h"
+
+bool MhwAvsCoefCache::Key::operator==(const Key &other) const
+{
+    return memcmp(this, &other, sizeof(Key)) == 0;
+}
+
+MhwAvsCoefCache &MhwAvsCoefCache::GetInstance()
+{
+    static MhwAvsCoefCache instance;
+    return instance;
+}
+
+MhwAvsCoefCache::~MhwAvsCoefCache()
+{
+    // Entries outlive every device, so they are not counted by MOS allocation tracking.
+    for (uint32_t i = 0; i < m_slotNum; i++)
+    {
+        delete m_slots[i].exchange(nullptr);
+    }
+}
+
+uint32_t MhwAvsCoefCache::FloatBits(float value)
+{
+    uint32_t bits = 0;
+    MOS_SecureMemcpy(&bits, sizeof(bits), &value, sizeof(value));
+    return bits;
+}
+
+uint32_t MhwAvsCoefCache::Hash(const Key &key)
+{
+    const uint32_t *words = (const uint32_t *)&key;
+    uint32_t        hash  = 2166136261u;
+    for (uint32_t i = 0; i < sizeof(Key) / sizeof(uint32_t); i++)
+    {
+        hash = (hash ^ words[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool MhwAvsCoefCache::Lookup(const Key &key, int32_t *coefs, uint32_t count)
+{
+    if (coefs == nullptr || count > MHW_AVS_COEF_CACHE_MAX_COEFS)
+    {
+        return false;
+    }
+
+    uint32_t hash = Hash(key);
+    for (uint32_t i = 0; i < m_probeNum; i++)
+    {
+        Entry *entry = m_slots[(hash + i) % m_slotNum].load(std::memory_order_acquire);
+        if (entry == nullptr)
+        {
+            // Slots are filled in probe order and never emptied, so the key is absent.
+            break;
+        }
+
+        // Entry may be overwritten meanwhile, the copy only counts if seq did not move.
+        uint32_t seq = entry->seq.load(std::memory_order_acquire);
+        if ((seq & 1) || entry->count != count || !(entry->key == key))
+        {
+            continue;
+        }
+        MOS_SecureMemcpy(coefs, count * sizeof(int32_t), entry->coefs, count * sizeof(int32_t));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry->seq.load(std::memory_order_relaxed) == seq)
+        {
+            m_hitCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    m_missCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void MhwAvsCoefCache::Insert(const Key &key, const int32_t *coefs, uint32_t count, uint64_t computeTime)
+{
+    m_missTime.fetch_add(computeTime, std::memory_order_relaxed);
+
+    if (coefs == nullptr || count > MHW_AVS_COEF_CACHE_MAX_COEFS)
+    {
+        return;
+    }
+
+    Entry *newEntry = new (std::nothrow) Entry;
+    if (newEntry == nullptr)
+    {
+        return;
+    }
+    newEntry->key   = key;
+    newEntry->count = count;
+    newEntry->stamp.store(m_stamp.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+    MOS_SecureMemcpy(newEntry->coefs, sizeof(newEntry->coefs), coefs, count * sizeof(int32_t));
+
+    Entry   *oldest      = nullptr;
+    uint64_t oldestStamp = UINT64_MAX;
+    uint32_t hash        = Hash(key);
+    for (uint32_t i = 0; i < m_probeNum; i++)
+    {
+        std::atomic<Entry *> &slot     = m_slots[(hash + i) % m_slotNum];
+        Entry                *expected = nullptr;
+        if (slot.compare_exchange_strong(expected, newEntry, std::memory_order_acq_rel))
+        {
+            m_entryCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        uint32_t seq = expected->seq.load(std::memory_order_acquire);
+        if (!(seq & 1) && expected->count == count && expected->key == key &&
+            expected->seq.load(std::memory_order_relaxed) == seq)
+        {
+            // Another thread published the same table first.
+            oldest = nullptr;
+            break;
+        }
+        uint64_t stamp = expected->stamp.load(std::memory_order_relaxed);
+        if (stamp < oldestStamp)
+        {
+            oldest      = expected;
+            oldestStamp = stamp;
+        }
+    }
+
+    // Probe window is full, scale ratios keep changing on this hash, so the
+    // oldest table gives way instead of the new one never being cached.
+    if (oldest != nullptr && Overwrite(oldest, key, coefs, count))
+    {
+        m_evictCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    delete newEntry;
+}
+
+bool MhwAvsCoefCache::Overwrite(Entry *entry, const Key &key, const int32_t *coefs, uint32_t count)
+{
+    // Odd seq marks the entry busy, readers and other writers skip it.
+    uint32_t seq = entry->seq.load(std::memory_order_relaxed);
+    if ((seq & 1) || !entry->seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire))
+    {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    entry->key   = key;
+    entry->count = count;
+    MOS_SecureMemcpy(entry->coefs, sizeof(entry->coefs), coefs, count * sizeof(int32_t));
+    entry->stamp.store(m_stamp.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+
+    entry->seq.store(seq + 2, std::memory_order_release);
+    return true;
+}
+
+MhwAvsCoefCache::Statistics MhwAvsCoefCache::GetStatistics()
+{
+    Statistics stats;
+    stats.hitCount   = m_hitCount.load(std::memory_order_relaxed);
+    stats.missCount  = m_missCount.load(std::memory_order_relaxed);
+    stats.missTime   = m_missTime.load(std::memory_order_relaxed);
+    stats.entryCount = m_entryCount.load(std::memory_order_relaxed);
+    stats.evictCount = m_evictCount.load(std::memory_order_relaxed);
+    return stats;
+}
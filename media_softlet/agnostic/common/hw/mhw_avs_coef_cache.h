@@ -0,0 +1,155 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mhw_avs_coef_cache.h
+//! \brief    Process wide cache of AVS polyphase coefficient tables
+//! \details  Polyphase tables only depend on a few scalar inputs, which barely
+//!           change between frames, while computing them takes hundreds of
+//!           Lanczos evaluations per plane. Tables are keyed by the exact bits
+//!           of every input which affects the result, so a hit is bit exact
+//!           with a recomputation. Lookup is lock free. When the probe window
+//!           of a key is full, the oldest entry in it is overwritten in place
+//!           under a per entry sequence count, entries are never freed before
+//!           process exit so a reader never touches released memory.
+//!
+#ifndef __MHW_AVS_COEF_CACHE_H__
+#define __MHW_AVS_COEF_CACHE_H__
+
+#include <atomic>
+#include <stdint.h>
+#include "mos_defs.h"
+#include "media_class_trace.h"
+
+#define MHW_AVS_COEF_CACHE_MAX_COEFS    256     //!< Largest table, 32 phases x 8 taps
+
+class MhwAvsCoefCache
+{
+public:
+    enum TableType
+    {
+        tableY = 0,
+        tableUV,
+        tableUVOffset
+    };
+
+    //!
+    //! \brief  Inputs of one table, float inputs are stored as raw bits
+    //!
+    struct Key
+    {
+        uint32_t type          = 0;
+        uint32_t scale         = 0;
+        uint32_t lanczosT      = 0;
+        uint32_t hpStrength    = 0;
+        uint32_t numEntries    = 0;   //!< Taps per phase, which is the plane class
+        uint32_t hwPhase       = 0;
+        uint32_t use8x8Filter  = 0;
+        int32_t  uvPhaseOffset = 0;
+
+        bool operator==(const Key &other) const;
+    };
+
+    struct Statistics
+    {
+        uint64_t hitCount    = 0;
+        uint64_t missCount   = 0;
+        uint64_t missTime    = 0;     //!< Total time in us spent computing missed tables
+        uint32_t entryCount  = 0;
+        uint64_t evictCount  = 0;     //!< Entries overwritten by a newer table
+    };
+
+    //!
+    //! \brief  Get process wide cache
+    //! \return MhwAvsCoefCache&
+    //!
+    static MhwAvsCoefCache &GetInstance();
+
+    //!
+    //! \brief  Float to raw bits, so keys compare bit exact
+    //!
+    static uint32_t FloatBits(float value);
+
+    //!
+    //! \brief  Copy cached table out if present
+    //! \param  [in] key
+    //!         Table inputs
+    //! \param  [out] coefs
+    //!         Table to fill
+    //! \param  [in] count
+    //!         Number of coefficients
+    //! \return bool
+    //!         true if table is found
+    //!
+    bool Lookup(const Key &key, int32_t *coefs, uint32_t count);
+
+    //!
+    //! \brief  Publish a computed table
+    //! \param  [in] key
+    //!         Table inputs
+    //! \param  [in] coefs
+    //!         Computed table
+    //! \param  [in] count
+    //!         Number of coefficients
+    //! \param  [in] computeTime
+    //!         Time in us spent computing the table
+    //!
+    void Insert(const Key &key, const int32_t *coefs, uint32_t count, uint64_t computeTime);
+
+    //!
+    //! \brief  Get hit/miss counters, e.g. for per frame CPU cost reporting
+    //! \return Statistics
+    //!
+    Statistics GetStatistics();
+
+    virtual ~MhwAvsCoefCache();
+
+protected:
+    struct Entry
+    {
+        std::atomic<uint32_t> seq {0};    //!< Odd while the entry is being written
+        std::atomic<uint64_t> stamp {0};  //!< Insert order, the smallest one in a probe window is evicted
+        Key                   key;
+        uint32_t              count = 0;
+        int32_t               coefs[MHW_AVS_COEF_CACHE_MAX_COEFS];
+    };
+
+    static const uint32_t m_slotNum  = 256;
+    static const uint32_t m_probeNum = 8;
+
+    MhwAvsCoefCache() {}
+
+    static uint32_t Hash(const Key &key);
+
+    bool Overwrite(Entry *entry, const Key &key, const int32_t *coefs, uint32_t count);
+
+    std::atomic<Entry *>  m_slots[m_slotNum] = {};
+    std::atomic<uint64_t> m_hitCount   {0};
+    std::atomic<uint64_t> m_missCount  {0};
+    std::atomic<uint64_t> m_missTime   {0};
+    std::atomic<uint32_t> m_entryCount {0};
+    std::atomic<uint64_t> m_evictCount {0};
+    std::atomic<uint64_t> m_stamp      {0};
+
+MEDIA_CLASS_DEFINE_END(MhwAvsCoefCache)
+};
+
+#endif  // __MHW_AVS_COEF_CACHE_H__
@@ -27,6 +27,7 @@
 #include <math.h>
 #include <set>
 #include "mhw_utilities_next.h"
+#include "mhw_avs_coef_cache.h"
 #include "mhw_state_heap.h"
 #include "mos_interface.h"
 #include "hal_oca_interface_next.h"
@@ -674,6 +675,30 @@ MOS_STATUS Mhw_SetNearestModeTable(
     return eStatus;
 }
 
+//!
+//! \brief      Lanczos factor of Y polyphase table, which depends on plane, format and scaling
+//!
+static float Mhw_GetPolyphaseLanczosTY(
+    float           fScaleFactor,
+    uint32_t        dwPlane,
+    MOS_FORMAT      srcFmt)
+{
+    if ((IS_YUV_FORMAT(srcFmt)    &&
+        dwPlane != MHW_U_PLANE    &&
+        dwPlane != MHW_V_PLANE)   ||
+        ((IS_RGB32_FORMAT(srcFmt) ||
+        srcFmt == Format_Y410     ||
+        srcFmt == Format_AYUV)    &&
+        dwPlane == MHW_Y_PLANE))
+    {
+        return (fScaleFactor < 1.0F) ? 4.0F : 8.0F;
+    }
+    else // if (dwPlane == MHW_U_PLANE || dwPlane == MHW_V_PLANE || (IS_RGB_FORMAT(srcFmt) && dwPlane != MHW_V_PLANE))
+    {
+        return 2.0F;
+    }
+}
+
 //!
 //! \brief      Calculate Polyphase tables for Y , across SFC and Render engine to set the sampler states
 //! \details    Calculate Polyphase tables for Y
@@ -699,7 +724,7 @@ MOS_STATUS Mhw_SetNearestModeTable(
 //! \return   MOS_STATUS
 //!           MOS_STATUS_SUCCESS if success, else fail reason
 //!
-MOS_STATUS Mhw_CalcPolyphaseTablesY(
+static MOS_STATUS Mhw_ComputePolyphaseTablesY(
     int32_t         *iCoefs,
     float           fScaleFactor,
     uint32_t        dwPlane,
@@ -742,28 +767,7 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
     dwTableCoefUnit = 1 << MHW_AVS_TBL_COEF_PREC;
     iCenterPixel = dwNumEntries / 2 - 1;
     fStartOffset = (float)(-iCenterPixel);
-
-    if ((IS_YUV_FORMAT(srcFmt)    &&
-        dwPlane != MHW_U_PLANE    &&
-        dwPlane != MHW_V_PLANE)   ||
-        ((IS_RGB32_FORMAT(srcFmt) ||
-        srcFmt == Format_Y410     ||
-        srcFmt == Format_AYUV)    &&
-        dwPlane == MHW_Y_PLANE))
-    {
-        if (fScaleFactor < 1.0F)
-        {
-            fLanczosT = 4.0F;
-        }
-        else
-        {
-            fLanczosT = 8.0F;
-        }
-    }
-    else // if (dwPlane == MHW_U_PLANE || dwPlane == MHW_V_PLANE || (IS_RGB_FORMAT(srcFmt) && dwPlane != MHW_V_PLANE))
-    {
-        fLanczosT = 2.0F;
-    }
+    fLanczosT    = Mhw_GetPolyphaseLanczosTY(fScaleFactor, dwPlane, srcFmt);
 
     for (i = 0; i < dwHwPhase; i++)
     {
@@ -848,7 +852,7 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
 //! \return   MOS_STATUS
 //!           MOS_STATUS_SUCCESS if success, else fail reason
 //!
-MOS_STATUS Mhw_CalcPolyphaseTablesUV(
+static MOS_STATUS Mhw_ComputePolyphaseTablesUV(
     int32_t    *piCoefs,
     float      fLanczosT,
     float      fInverseScaleFactor)
@@ -939,7 +943,7 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUV(
 //! \return   MOS_STATUS
 //!           MOS_STATUS_SUCCESS if success, else fail reason
 //!
-MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
+static MOS_STATUS Mhw_ComputePolyphaseTablesUVOffset(
     int32_t     *piCoefs,
     float       fLanczosT,
     float       fInverseScaleFactor,
@@ -1019,6 +1023,104 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
     return eStatus;
 }
 
+MOS_STATUS Mhw_CalcPolyphaseTablesY(
+    int32_t         *iCoefs,
+    float           fScaleFactor,
+    uint32_t        dwPlane,
+    MOS_FORMAT      srcFmt,
+    float           fHPStrength,
+    bool            bUse8x8Filter,
+    uint32_t        dwHwPhase,
+    float           fLanczosT)
+{
+    MHW_CHK_NULL_RETURN(iCoefs);
+
+    bool     yPlane     = (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE);
+    uint32_t numEntries = yPlane ? NUM_POLYPHASE_Y_ENTRIES : NUM_POLYPHASE_UV_ENTRIES;
+
+    // fLanczosT passed in is always overridden, only the derived one matters.
+    MhwAvsCoefCache::Key key;
+    key.type         = MhwAvsCoefCache::tableY;
+    key.scale        = MhwAvsCoefCache::FloatBits(fScaleFactor);
+    key.lanczosT     = MhwAvsCoefCache::FloatBits(Mhw_GetPolyphaseLanczosTY(fScaleFactor, dwPlane, srcFmt));
+    key.hpStrength   = yPlane ? MhwAvsCoefCache::FloatBits(fHPStrength) : 0;
+    key.numEntries   = numEntries;
+    key.hwPhase      = dwHwPhase;
+    key.use8x8Filter = bUse8x8Filter;
+
+    MhwAvsCoefCache &cache = MhwAvsCoefCache::GetInstance();
+    uint32_t         count = dwHwPhase * numEntries;
+    if (cache.Lookup(key, iCoefs, count))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint64_t startTime = MosUtilities::MosGetCurTime();
+    MHW_CHK_STATUS_RETURN(Mhw_ComputePolyphaseTablesY(iCoefs, fScaleFactor, dwPlane, srcFmt, fHPStrength, bUse8x8Filter, dwHwPhase, fLanczosT));
+    cache.Insert(key, iCoefs, count, MosUtilities::MosGetCurTime() - startTime);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS Mhw_CalcPolyphaseTablesUV(
+    int32_t    *piCoefs,
+    float      fLanczosT,
+    float      fInverseScaleFactor)
+{
+    MHW_CHK_NULL_RETURN(piCoefs);
+
+    // Upscaling factors all give the same table, as sf is clamped to 1.
+    float sf = MOS_MIN(1.0F, fInverseScaleFactor);
+
+    MhwAvsCoefCache::Key key;
+    key.type     = MhwAvsCoefCache::tableUV;
+    key.scale    = MhwAvsCoefCache::FloatBits(sf);
+    key.lanczosT = MhwAvsCoefCache::FloatBits(sf < 1.0F ? 2.0F : fLanczosT);
+
+    MhwAvsCoefCache &cache = MhwAvsCoefCache::GetInstance();
+    uint32_t         count = MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT;
+    if (cache.Lookup(key, piCoefs, count))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint64_t startTime = MosUtilities::MosGetCurTime();
+    MHW_CHK_STATUS_RETURN(Mhw_ComputePolyphaseTablesUV(piCoefs, fLanczosT, fInverseScaleFactor));
+    cache.Insert(key, piCoefs, count, MosUtilities::MosGetCurTime() - startTime);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
+    int32_t     *piCoefs,
+    float       fLanczosT,
+    float       fInverseScaleFactor,
+    int32_t     iUvPhaseOffset)
+{
+    MHW_CHK_NULL_RETURN(piCoefs);
+
+    float sf = MOS_MIN(1.0F, fInverseScaleFactor);
+
+    MhwAvsCoefCache::Key key;
+    key.type          = MhwAvsCoefCache::tableUVOffset;
+    key.scale         = MhwAvsCoefCache::FloatBits(sf);
+    key.lanczosT      = MhwAvsCoefCache::FloatBits(sf < 1.0F ? 3.0F : fLanczosT);
+    key.uvPhaseOffset = iUvPhaseOffset;
+
+    MhwAvsCoefCache &cache = MhwAvsCoefCache::GetInstance();
+    uint32_t         count = MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT;
+    if (cache.Lookup(key, piCoefs, count))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint64_t startTime = MosUtilities::MosGetCurTime();
+    MHW_CHK_STATUS_RETURN(Mhw_ComputePolyphaseTablesUVOffset(piCoefs, fLanczosT, fInverseScaleFactor, iUvPhaseOffset));
+    cache.Insert(key, piCoefs, count, MosUtilities::MosGetCurTime() - startTime);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 //!
 //! \brief    Allocate BB
 //! \details  Allocated Batch Buffer
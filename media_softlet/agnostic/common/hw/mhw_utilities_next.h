@@ -605,6 +605,7 @@ struct _MHW_BATCH_BUFFER
     uint32_t                count;                          //!< Actual batch count in this resource. If larger than 1, multiple buffer has equal size and resource size count * size.
     int32_t                 iCurrent;                       //!< Current offset in CB
     bool                    bLocked;                        //!< True if locked in memory (pData must be valid)
+    bool                    bMapped;                        //!< True if OsResource stays locked after unlock, pData is kept for next lock
     uint8_t* pData;                          //!< Pointer to BB data
 #if (_DEBUG || _RELEASE_INTERNAL)
     int32_t                     iLastCurrent;                   //!< Save offset in CB (for debug plug-in/out)
@@ -0,0 +1,182 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_kernel_blob.cpp
+//! \brief    Implements loader of compressed kernel binaries
+//!
+
+#include "media_kernel_blob.h"
+#include "mos_utilities.h"
+
+std::mutex                                    MediaKernelBlob::m_mutex;
+std::map<const void *, std::vector<uint32_t>> MediaKernelBlob::m_cache;
+MediaKernelBlob::Statistics                   MediaKernelBlob::m_stats;
+
+bool MediaKernelBlob::IsCompressed(const void *data, uint32_t size)
+{
+    if (data == nullptr || size < sizeof(MEDIA_KERNEL_BLOB_HEADER))
+    {
+        return false;
+    }
+
+    const MEDIA_KERNEL_BLOB_HEADER *header = (const MEDIA_KERNEL_BLOB_HEADER *)data;
+    return header->magic == MEDIA_KERNEL_BLOB_MAGIC &&
+           header->version == MEDIA_KERNEL_BLOB_VERSION &&
+           header->dataSize <= size - sizeof(MEDIA_KERNEL_BLOB_HEADER);
+}
+
+MOS_STATUS MediaKernelBlob::Load(const void *data, uint32_t size, const void *&kernel, uint32_t &kernelSize)
+{
+    kernel     = data;
+    kernelSize = size;
+
+    if (!IsCompressed(data, size))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    kernel     = nullptr;
+    kernelSize = 0;
+
+    const MEDIA_KERNEL_BLOB_HEADER *header = (const MEDIA_KERNEL_BLOB_HEADER *)data;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_cache.find(data);
+    if (it == m_cache.end())
+    {
+        uint64_t startTime = MosUtilities::MosGetCurTime();
+
+        std::vector<uint32_t> raw;
+        try
+        {
+            raw.resize(MOS_ROUNDUP_DIVIDE(header->rawSize, sizeof(uint32_t)));
+        }
+        catch (const std::bad_alloc &)
+        {
+            MOS_OS_ASSERTMESSAGE("Failed to allocate %u bytes for kernel binary.", header->rawSize);
+            return MOS_STATUS_NO_SPACE;
+        }
+
+        if (!Decompress((const uint8_t *)(header + 1), header->dataSize, (uint8_t *)raw.data(), header->rawSize))
+        {
+            MOS_OS_ASSERTMESSAGE("Kernel binary blob is corrupted.");
+            return MOS_STATUS_INVALID_PARAMETER;
+        }
+
+        m_stats.blobCount++;
+        m_stats.compressedSize += size;
+        m_stats.rawSize += header->rawSize;
+        m_stats.decompressTime += MosUtilities::MosGetCurTime() - startTime;
+
+        it = m_cache.emplace(data, std::move(raw)).first;
+    }
+
+    // Vector storage never moves once in map, so the pointer is valid for process lifetime.
+    kernel     = it->second.data();
+    kernelSize = header->rawSize;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MediaKernelBlob::Statistics MediaKernelBlob::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+bool MediaKernelBlob::Decompress(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize)
+{
+    // LZ4 block format: sequences of token, literal length, literals, match offset and match length.
+    // Last sequence only has literals. Every read and write is bounds checked as blob is untrusted input.
+    const uint8_t *ip    = src;
+    const uint8_t *ipEnd = src + srcSize;
+    uint8_t       *op    = dst;
+    uint8_t       *opEnd = dst + dstSize;
+
+    auto readLength = [&](uint32_t &length) {
+        uint8_t byte = 0;
+        do
+        {
+            if (ip >= ipEnd)
+            {
+                return false;
+            }
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    };
+
+    while (ip < ipEnd)
+    {
+        uint32_t token    = *ip++;
+        uint32_t literals  = token >> 4;
+        if (literals == 15 && !readLength(literals))
+        {
+            return false;
+        }
+        if (literals > (uint32_t)(ipEnd - ip) || literals > (uint32_t)(opEnd - op))
+        {
+            return false;
+        }
+        MOS_SecureMemcpy(op, opEnd - op, ip, literals);
+        ip += literals;
+        op += literals;
+
+        if (ip == ipEnd)
+        {
+            break;
+        }
+
+        if (ipEnd - ip < 2)
+        {
+            return false;
+        }
+        uint32_t offset = ip[0] | ((uint32_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - dst))
+        {
+            return false;
+        }
+
+        uint32_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(matchLength))
+        {
+            return false;
+        }
+        matchLength += 4;
+        if (matchLength > (uint32_t)(opEnd - op))
+        {
+            return false;
+        }
+
+        // Match may overlap with output, copy byte by byte.
+        const uint8_t *match = op - offset;
+        for (uint32_t i = 0; i < matchLength; i++)
+        {
+            *op++ = *match++;
+        }
+    }
+
+    return op == opEnd;
+}
@@ -0,0 +1,121 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_kernel_blob.h
+//! \brief    Defines loader of compressed kernel binaries
+//! \details  KernelBinToSource emits a kernel binary as compressed blob when
+//!           run with "-c 1". The blob is a MEDIA_KERNEL_BLOB_HEADER followed
+//!           by an LZ4 block format stream, padded to uint32_t. Only kernels
+//!           of the running platform are referenced at runtime, so the blobs
+//!           of other platforms stay as small read only data which is never
+//!           paged in. A blob is decompressed on first use into a process
+//!           wide cache shared by all devices.
+//!
+//!           Load() accepts both compressed and plain kernel binaries, so
+//!           callers do not need to know how a kernel is built.
+//!
+#ifndef __MEDIA_KERNEL_BLOB_H__
+#define __MEDIA_KERNEL_BLOB_H__
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include "mos_defs.h"
+#include "media_class_trace.h"
+
+#define MEDIA_KERNEL_BLOB_MAGIC     0x5A424B4D  // MKBZ
+#define MEDIA_KERNEL_BLOB_VERSION   1
+
+struct MEDIA_KERNEL_BLOB_HEADER
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rawSize;   //!< Kernel binary size in bytes after decompression
+    uint32_t dataSize;  //!< Compressed stream size in bytes following the header
+};
+
+class MediaKernelBlob
+{
+public:
+    struct Statistics
+    {
+        uint32_t blobCount      = 0;  //!< Blobs decompressed so far
+        uint64_t compressedSize = 0;  //!< Total size of decompressed blobs in driver image
+        uint64_t rawSize        = 0;  //!< Total size of decompressed kernels in cache
+        uint64_t decompressTime = 0;  //!< Total decompression time in us
+    };
+
+    //!
+    //! \brief  Check if kernel binary is a compressed blob
+    //! \param  [in] data
+    //!         Kernel binary
+    //! \param  [in] size
+    //!         Kernel binary size in bytes
+    //! \return bool
+    //!
+    static bool IsCompressed(const void *data, uint32_t size);
+
+    //!
+    //! \brief  Get usable kernel binary
+    //! \details Compressed blob is decompressed on first call and cached for
+    //!          the process lifetime, plain kernel binary is returned as is.
+    //! \param  [in] data
+    //!         Kernel binary or compressed blob
+    //! \param  [in] size
+    //!         Size of data in bytes
+    //! \param  [out] kernel
+    //!         Kernel binary, nullptr if blob is corrupted or out of memory
+    //! \param  [out] kernelSize
+    //!         Kernel binary size in bytes
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    static MOS_STATUS Load(const void *data, uint32_t size, const void *&kernel, uint32_t &kernelSize);
+
+    //!
+    //! \brief  Typed variant of Load for uint32_t kernel arrays
+    //!
+    static MOS_STATUS Load(const uint32_t *data, uint32_t size, const uint32_t *&kernel, uint32_t &kernelSize)
+    {
+        const void *out    = nullptr;
+        MOS_STATUS  status = Load((const void *)data, size, out, kernelSize);
+        kernel             = (const uint32_t *)out;
+        return status;
+    }
+
+    //!
+    //! \brief  Get decompression statistics of current process
+    //! \return Statistics
+    //!
+    static Statistics GetStatistics();
+
+protected:
+    static bool Decompress(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize);
+
+    static std::mutex                                        m_mutex;
+    static std::map<const void *, std::vector<uint32_t>>     m_cache;  //!< Keyed by blob address
+    static Statistics                                        m_stats;
+
+MEDIA_CLASS_DEFINE_END(MediaKernelBlob)
+};
+
+#endif  // __MEDIA_KERNEL_BLOB_H__
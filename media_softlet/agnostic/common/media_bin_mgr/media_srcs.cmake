@@ -20,6 +20,12 @@
 
 set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/media_bin_mgr.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_kernel_blob.h
+)
+
+set(SOFTLET_COMMON_SOURCES_
+    ${SOFTLET_COMMON_SOURCES_}
+    ${CMAKE_CURRENT_LIST_DIR}/media_kernel_blob.cpp
 )
 
 set(SOFTLET_COMMON_HEADERS_
@@ -34,7 +40,7 @@ set(SOFTLET_COMMON_PRIVATE_INCLUDE_DIRS_
 
 set(MEDIA_BIN_HEADERS_
     ${MEDIA_BIN_HEADERS_}
-    ${TMP_HEADERS_}
+    ${CMAKE_CURRENT_LIST_DIR}/media_bin_mgr.h
 )
 set(MEDIA_BIN_INCLUDE_DIR
     ${MEDIA_BIN_INCLUDE_DIR}
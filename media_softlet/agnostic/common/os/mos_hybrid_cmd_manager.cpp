@@ -141,6 +141,8 @@ bool HybridCmdMgr::Enabled()
 
 void HybridCmdMgr::Consumer()
 {
+    MosUtilities::MosBindThreadToNumaNode();
+
     while (true)
     {
         std::unique_lock<std::mutex> lock(m_queueMutex);
@@ -362,6 +362,24 @@ MOS_STATUS MosUserSetting::InitMosCommonUserSetting(MediaUserSettingSharedPtr us
         true,
         USER_SETTING_CONFIG_PERF_PATH); //"Performance Profiler Memory Information Register."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_LATENCY_ENABLE,
+        MediaUserSetting::Group::Device,
+        int32_t(0),
+        true,
+        true,
+        USER_SETTING_CONFIG_PERF_PATH); //"Always on per stage GPU latency histograms."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_LATENCY_EXPORT_MS,
+        MediaUserSetting::Group::Device,
+        uint32_t(0),
+        true,
+        true,
+        USER_SETTING_CONFIG_PERF_PATH); //"Interval in ms of latency histogram export, 0 means no export."
+
 #if MOS_COMMAND_BUFFER_DUMP_SUPPORTED
     DeclareUserSettingKey(
         userSettingPtr,
@@ -1188,6 +1188,60 @@ public:
         const void          *pSource,
         size_t              srcLength);
 
+    //!
+    //! \brief    Memory copy from write combined memory with security checks.
+    //! \details  Same as MosSecureMemcpy, but reads the source with streaming
+    //!           loads when the CPU supports them, which avoids one uncached
+    //!           read per load on write combined mappings such as locked
+    //!           surfaces and bitstream buffers. Large copies also use non
+    //!           temporal stores so the destination does not evict the caches.
+    //!           Plain memory is copied correctly, just not faster than memcpy.
+    //! \param    [out] pDestination
+    //!           Pointer to destination buffer
+    //! \param    [in] dstLength
+    //!           Size of the destination buffer
+    //! \param    [in] pSource
+    //!           Pointer to the source buffer
+    //! \param    [in] srcLength
+    //!           Number of bytes to copy from source to destination
+    //! \return   MOS_STATUS
+    //!           Returns one of the MOS_STATUS error codes if failed,
+    //!           else MOS_STATUS_SUCCESS
+    //!
+    static MOS_STATUS MosStreamingMemcpy(
+        void                *pDestination,
+        size_t              dstLength,
+        const void          *pSource,
+        size_t              srcLength);
+
+    //!
+    //! \brief    2D memory copy from write combined memory.
+    //! \details  Copy widthInBytes of each of height rows with MosStreamingMemcpy,
+    //!           rows are contiguous if pitch equals to widthInBytes.
+    //! \param    [out] pDestination
+    //!           Pointer to first row of destination
+    //! \param    [in] dstPitch
+    //!           Destination pitch in bytes
+    //! \param    [in] pSource
+    //!           Pointer to first row of source
+    //! \param    [in] srcPitch
+    //!           Source pitch in bytes
+    //! \param    [in] widthInBytes
+    //!           Bytes to copy per row, must not exceed either pitch
+    //! \param    [in] height
+    //!           Number of rows
+    //! \return   MOS_STATUS
+    //!           Returns one of the MOS_STATUS error codes if failed,
+    //!           else MOS_STATUS_SUCCESS
+    //!
+    static MOS_STATUS MosStreamingMemcpy2D(
+        void                *pDestination,
+        uint32_t            dstPitch,
+        const void          *pSource,
+        uint32_t            srcPitch,
+        uint32_t            widthInBytes,
+        uint32_t            height);
+
     //!
     //! \brief    Open a file with security checks.
     //! \details  Open a file with security checks.
@@ -1773,6 +1827,90 @@ public:
     //!
     static uint32_t MosGetCurrentThreadId();
 
+    //!
+    //! \brief    Set NUMA node which driver memory and threads are placed on
+    //! \details  Set per device at OS context init. Large allocations of
+    //!           MosAllocMemory and MosAlignedAllocMemory prefer the node, and
+    //!           driver created threads run on CPUs of the node if thread affinity
+    //!           is enabled. A process driving devices on different nodes gets no
+    //!           placement, as no node is local to all of them.
+    //! \param    [in] node
+    //!           NUMA node of the device, -1 if unknown
+    //! \param    [in] localAlloc
+    //!           Prefer the node for large allocations
+    //! \param    [in] threadAffinity
+    //!           Run driver created threads on CPUs of the node
+    //! \return   void
+    //!
+    static void MosSetNumaNode(
+        int32_t                     node,
+        bool                        localAlloc,
+        bool                        threadAffinity);
+
+    //!
+    //! \brief    Get NUMA node set by MosSetNumaNode
+    //! \return   int32_t
+    //!           NUMA node, -1 if memory and threads are not placed
+    //!
+    static int32_t MosGetNumaNode();
+
+    //!
+    //! \brief    Bind calling thread to the NUMA node
+    //! \details  Called at start of driver created threads. No-op unless
+    //!           thread affinity is enabled by MosSetNumaNode.
+    //! \return   void
+    //!
+    static void MosBindThreadToNumaNode();
+
+    //!
+    //! \brief    Allocate memory preferring the NUMA node
+    //! \details  Serves large allocations of MosAllocMemory, MosAllocAndZeroMemory
+    //!           and MosAlignedAllocMemory when local allocation is enabled by
+    //!           MosSetNumaNode. The memory is a zeroed mapping of its own, so the
+    //!           node policy is dropped with it by MosFreeMemoryOnNumaNode and
+    //!           never reaches heap pages.
+    //! \param    [in] size
+    //!           Size of allocation in bytes
+    //! \param    [in] alignment
+    //!           Alignment of allocation, at most MOS_PAGE_SIZE
+    //! \return   void *
+    //!           Pointer to the memory, nullptr if the allocation is too small,
+    //!           placement is off or it fails, the caller then uses the heap
+    //!
+    static void *MosAllocMemoryOnNumaNode(
+        size_t                      size,
+        size_t                      alignment);
+
+    //!
+    //! \brief    Get mapped size of memory from MosAllocMemoryOnNumaNode
+    //! \param    [in] ptr
+    //!           Pointer to the memory
+    //! \return   size_t
+    //!           Size in bytes rounded up to pages, 0 if ptr is not from
+    //!           MosAllocMemoryOnNumaNode
+    //!
+    static size_t MosGetNumaMemorySize(
+        const void                  *ptr);
+
+    //!
+    //! \brief    Free memory from MosAllocMemoryOnNumaNode
+    //! \param    [in] ptr
+    //!           Pointer to the memory
+    //! \return   bool
+    //!           true if ptr was from MosAllocMemoryOnNumaNode and is unmapped,
+    //!           false if it belongs to the heap
+    //!
+    static bool MosFreeMemoryOnNumaNode(
+        void                        *ptr);
+
+    //!
+    //! \brief    Print resident memory of the process per NUMA node
+    //! \details  No-op unless local allocation or thread affinity is enabled
+    //!           by MosSetNumaNode.
+    //! \return   void
+    //!
+    static void MosReportNumaMemory();
+
     //!
     //! \brief    Wait for thread to terminate
     //! \details  Wait for thread to terminate
@@ -2135,6 +2273,18 @@ public:
         return m_mosTraceEnable && m_mosTraceFilter(key);
     }
 
+    //!
+    //! \brief    check if trace event is enabled
+    //! \details  lock free check of trace enable and per event id bitmap in trace control data,
+    //!           call sites check it before building event payload
+    //! \param    [in] trace event id
+    //! \return   bool
+    //!
+    static bool TraceEventEnabled(uint16_t usId)
+    {
+        return m_mosTraceEnable && m_mosTraceEventFilter(usId);
+    }
+
     //!
     //! \brief    check if trace level is enabled
     //! \details  if a trace level is enabled, returns true, otherwise false
@@ -2896,6 +3046,7 @@ private:
     static const MtControlData         *m_mosTraceControlData;
     static MtEnable                     m_mosTraceEnable;
     static MtFilter                     m_mosTraceFilter;
+    static MtEventFilter                m_mosTraceEventFilter;
     static MtLevel                      m_mosTraceLevel;
     static MosMutex                     m_mutexLock;
     static uint32_t                     m_mosUtilInitCount; // number count of mos utilities init
@@ -3246,6 +3397,12 @@ do{                                                     \
 #define MOS_SecureMemcpy(pDestination, dstLength, pSource, srcLength)                               \
     MosUtilities::MosSecureMemcpy(pDestination, dstLength, pSource, srcLength)
 
+#define MOS_StreamingMemcpy(pDestination, dstLength, pSource, srcLength)                            \
+    MosUtilities::MosStreamingMemcpy(pDestination, dstLength, pSource, srcLength)
+
+#define MOS_StreamingMemcpy2D(pDestination, dstPitch, pSource, srcPitch, widthInBytes, height)      \
+    MosUtilities::MosStreamingMemcpy2D(pDestination, dstPitch, pSource, srcPitch, widthInBytes, height)
+
 #define MOS_SecureStringPrint(buffer, bufSize, length, format, ...)                                 \
     MosUtilities::MosSecureStringPrint(buffer, bufSize, length, format, ##__VA_ARGS__)
 
@@ -3259,6 +3416,7 @@ do{                                                     \
 //------------------------------------------------------------------------------
 
 #define MOS_TraceKeyEnabled(key) MosUtilities::TraceKeyEnabled(key)
+#define MOS_TraceEventEnabled(usId) MosUtilities::TraceEventEnabled(usId)
 
 inline void MOS_TraceEvent(
     uint16_t    usId,
@@ -3268,7 +3426,10 @@ inline void MOS_TraceEvent(
     const void *pArg2   = nullptr,
     uint32_t    dwSize2 = 0)
 {
-    MosUtilities::MosTraceEvent(usId, ucType, pArg1, dwSize1, pArg2, dwSize2);
+    if (MosUtilities::TraceEventEnabled(usId))
+    {
+        MosUtilities::MosTraceEvent(usId, ucType, pArg1, dwSize1, pArg2, dwSize2);
+    }
 }
 
 inline void MOS_TraceEvent(
@@ -3280,7 +3441,7 @@ inline void MOS_TraceEvent(
     const void              *pArg2   = nullptr,
     uint32_t                 dwSize2 = 0)
 {
-    if (MosUtilities::TraceKeyEnabled(key))
+    if (MosUtilities::TraceKeyEnabled(key) && MosUtilities::TraceEventEnabled(usId))
     {
         MosUtilities::MosTraceEvent(usId, ucType, pArg1, dwSize1, pArg2, dwSize2);
     }
@@ -3296,7 +3457,7 @@ inline void MOS_TraceEvent(
     const void              *pArg2   = nullptr,
     uint32_t                 dwSize2 = 0)
 {
-    if (MosUtilities::TraceKeyEnabled(key) && MosUtilities::TracelevelEnabled(level))
+    if (MosUtilities::TraceKeyEnabled(key) && MosUtilities::TraceEventEnabled(usId) && MosUtilities::TracelevelEnabled(level))
     {
         MosUtilities::MosTraceEvent(usId, ucType, pArg1, dwSize1, pArg2, dwSize2);
     }
@@ -3371,12 +3532,13 @@ inline void MOS_TraceDataDump(
 //! \def MOS_TraceData new trace interface, special interface for zero trace data
 //!
 #define MOS_TraceData0(usId, usType) \
-    MosUtilities::MosTraceEvent(usId, usType, nullptr, 0, nullptr, 0);
+    MOS_TraceEvent(usId, usType, nullptr, 0, nullptr, 0);
 
-#define MOS_TraceData(usId, usType, ...)                           \
-    {                                                              \
-        TR_FILL_PARAM(__VA_ARGS__);                                \
-        TR_WRITE_PARAM(MosUtilities::MosTraceEvent, usId, usType); \
+#define MOS_TraceData(usId, usType, ...)                               \
+    if (MosUtilities::TraceEventEnabled(usId))                         \
+    {                                                                  \
+        TR_FILL_PARAM(__VA_ARGS__);                                    \
+        TR_WRITE_PARAM(MosUtilities::MosTraceEvent, usId, usType);     \
     }
 
 class PerfUtility
@@ -35,6 +35,7 @@ int32_t              MosUtilities::m_mosMemAllocCounterNoUserFeatureGfx = 0;
 const MtControlData *MosUtilities::m_mosTraceControlData                = nullptr;
 MtEnable             MosUtilities::m_mosTraceEnable                     = false;
 MtFilter             MosUtilities::m_mosTraceFilter                     = {};
+MtEventFilter        MosUtilities::m_mosTraceEventFilter                = {};
 MtLevel              MosUtilities::m_mosTraceLevel                      = {};
 
 uint64_t MosUtilities::MosGetCurTime()
@@ -210,7 +211,11 @@ void  *MosUtilities::MosAlignedAllocMemory(
     }
 #endif
 
-    ptr = _aligned_malloc(size, alignment);
+    ptr = MosAllocMemoryOnNumaNode(size, alignment);
+    if (ptr == nullptr)
+    {
+        ptr = _aligned_malloc(size, alignment);
+    }
 
     MOS_OS_ASSERT(ptr != nullptr);
 
@@ -246,7 +251,10 @@ void MosUtilities::MosAlignedFreeMemory(void *ptr)
         PRINT_DESTROY_MEMORY(MT_MOS_DESTROY_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
                 functionName, filename, line);        
-        _aligned_free(ptr);
+        if (!MosFreeMemoryOnNumaNode(ptr))
+        {
+            _aligned_free(ptr);
+        }
     }
 }
 
@@ -269,7 +277,11 @@ void *MosUtilities::MosAllocMemory(size_t size)
     }
 #endif
 
-    ptr = malloc(size);
+    ptr = MosAllocMemoryOnNumaNode(size, NO_ALLOC_ALIGNMENT);
+    if (ptr == nullptr)
+    {
+        ptr = malloc(size);
+    }
 
     MOS_OS_ASSERT(ptr != nullptr);
 
@@ -305,14 +317,21 @@ void *MosUtilities::MosAllocAndZeroMemory(size_t size)
     }
 #endif
 
-    ptr = malloc(size);
+    // A fresh mapping is zero already, only heap memory needs clearing.
+    ptr = MosAllocMemoryOnNumaNode(size, NO_ALLOC_ALIGNMENT);
+    if (ptr == nullptr)
+    {
+        ptr = malloc(size);
+        if (ptr != nullptr)
+        {
+            MosZeroMemory(ptr, size);
+        }
+    }
 
     MOS_OS_ASSERT(ptr != nullptr);
 
     if(ptr != nullptr)
     {
-        MosZeroMemory(ptr, size);
-
         MosAtomicIncrement(m_mosMemAllocCounter);
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
         PRINT_ALLOCATE_MEMORY(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
@@ -348,7 +367,26 @@ void *MosUtilities::MosReallocMemory(
 #endif
 
     oldPtr = reinterpret_cast<uintptr_t>(ptr);
-    newPtr = realloc(ptr, newSize);
+
+    size_t numaSize = MosGetNumaMemorySize(ptr);
+    if (numaSize != 0)
+    {
+        // realloc() can't take a mapping of MosAllocMemoryOnNumaNode, move it by hand.
+        newPtr = MosAllocMemoryOnNumaNode(newSize, NO_ALLOC_ALIGNMENT);
+        if (newPtr == nullptr)
+        {
+            newPtr = malloc(newSize);
+        }
+        if (newPtr != nullptr)
+        {
+            MosSecureMemcpy(newPtr, newSize, ptr, MOS_MIN(numaSize, newSize));
+            MosFreeMemoryOnNumaNode(ptr);
+        }
+    }
+    else
+    {
+        newPtr = realloc(ptr, newSize);
+    }
 
     MOS_OS_ASSERT(newPtr != nullptr);
 
@@ -403,7 +441,10 @@ void MosUtilities::MosFreeMemory(void  *ptr)
         PRINT_DESTROY_MEMORY(MT_MOS_DESTROY_MEMORY, MT_NORMAL, 
             MT_MEMORY_PTR, (int64_t)(ptr), 
             functionName, filename, line); 
-        free(ptr);
+        if (!MosFreeMemoryOnNumaNode(ptr))
+        {
+            free(ptr);
+        }
         ptr = nullptr;
     }
 }
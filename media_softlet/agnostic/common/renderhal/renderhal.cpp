@@ -1982,6 +1982,7 @@ MOS_STATUS RenderHal_AllocateBB(
     pBatchBuffer->iSize            = iSize;
     pBatchBuffer->iCurrent         = 0;
     pBatchBuffer->bLocked          = false;
+    pBatchBuffer->bMapped          = false;
     pBatchBuffer->pData            = nullptr;
 
     pBatchBuffer->dwOffset         = 0;
@@ -2038,6 +2039,15 @@ MOS_STATUS RenderHal_FreeBB(
         MHW_RENDERHAL_CHK_STATUS_RETURN(pRenderHal->pfnUnlockBB(pRenderHal, pBatchBuffer));
     }
 
+    if (pBatchBuffer->bMapped)
+    {
+        MHW_RENDERHAL_CHK_STATUS_RETURN(pOsInterface->pfnUnlockResource(
+                    pOsInterface,
+                    &pBatchBuffer->OsResource));
+        pBatchBuffer->bMapped = false;
+        pBatchBuffer->pData   = nullptr;
+    }
+
     pOsInterface->pfnFreeResource(pOsInterface, &pBatchBuffer->OsResource);
 
     pBatchBuffer->dwSyncTag        = 0;
@@ -2070,6 +2080,9 @@ MOS_STATUS RenderHal_FreeBB(
 //!
 //! \brief    Lock BB
 //! \details  Locks Batch Buffer
+//!           The CPU mapping is kept across unlock, so locking a BB which GPU
+//!           is done with (bBusy cleared by sync tag) only hands out pData.
+//!           A BB still busy is unmapped and locked again, which waits for GPU.
 //! \param    PRENDERHAL_INTERFACE pRenderHal
 //!           [in] Pointer to Hardware Interface Structure
 //! \param    PMHW_BATCH_BUFFER pBatchBuffer
@@ -2099,6 +2112,20 @@ MOS_STATUS RenderHal_LockBB(
         return eStatus;
     }
 
+    if (pBatchBuffer->bMapped)
+    {
+        if (!pBatchBuffer->bBusy && pBatchBuffer->pData)
+        {
+            pBatchBuffer->bLocked = true;
+            return MOS_STATUS_SUCCESS;
+        }
+
+        MHW_RENDERHAL_CHK_STATUS_RETURN(pOsInterface->pfnUnlockResource(
+                    pOsInterface,
+                    &pBatchBuffer->OsResource));
+        pBatchBuffer->bMapped = false;
+    }
+
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
 
     LockFlags.WriteOnly = 1;
@@ -2118,7 +2145,8 @@ MOS_STATUS RenderHal_LockBB(
 
 //!
 //! \brief    Unlock BB
-//! \details  Unlocks Batch Buffer
+//! \details  Unlocks Batch Buffer, the resource stays mapped until the BB
+//!           is locked while busy or freed
 //! \param    PRENDERHAL_INTERFACE pRenderHal
 //!           [in] Pointer to Hardware Interface Structure
 //! \param    PMHW_BATCH_BUFFER pBatchBuffer
@@ -2147,11 +2175,8 @@ MOS_STATUS RenderHal_UnlockBB(
         return eStatus;
     }
 
-    MHW_RENDERHAL_CHK_STATUS_RETURN(pOsInterface->pfnUnlockResource(
-                pOsInterface,
-                &pBatchBuffer->OsResource));
-
     pBatchBuffer->bLocked = false;
+    pBatchBuffer->bMapped = true;
 
     eStatus = MOS_STATUS_SUCCESS;
 
@@ -744,6 +744,7 @@ protected:
     {
         m_gfxMemAsyncData.scheduler = std::thread(
             [this] {
+                MosUtilities::MosBindThreadToNumaNode();
                 std::future<void> future;
                 while (true)
                 {
@@ -788,6 +789,7 @@ protected:
 
         m_sysMemAsyncData.scheduler = std::thread(
             [this] {
+                MosUtilities::MosBindThreadToNumaNode();
                 std::future<void> future;
                 while (true)
                 {
@@ -30,6 +30,7 @@
 #include "media_render_copy_next.h"
 #include "media_interfaces_mhw_next.h"
 #include "media_render_common.h"
+#include "media_kernel_blob.h"
 
 //!
 //! \brief Initialize MHW Kernel Param struct for loading Kernel
@@ -216,8 +217,8 @@ MOS_STATUS RenderCopyStateNext::SetupKernel(
         return MOS_STATUS_UNKNOWN;
     }
 
-    pcKernelBin = m_KernelBin;
-    dwKernelBinSize = m_KernelBinSize;
+    // The platform kernel array may be shipped compressed; expand it once.
+    MCPY_CHK_STATUS_RETURN(MediaKernelBlob::Load(m_KernelBin, m_KernelBinSize, pcKernelBin, dwKernelBinSize));
 
     if (nullptr == m_pKernelBin)
     {
@@ -32,6 +32,7 @@
 #include "media_packet.h"
 #include "media_interfaces_mcpy_next.h"
 #include "media_debug_interface.h"
+#include "media_worker_pool.h"
 
 MediaPipeline::MediaPipeline(PMOS_INTERFACE osInterface) : m_osInterface(osInterface)
 {
@@ -154,6 +155,9 @@ MediaPacket *MediaPipeline::GetOrCreate(uint32_t packetId)
     auto iterCreator = m_packetCreators.find(packetId);
     if (iterCreator != m_packetCreators.end())
     {
+        uint64_t startTime = 0;
+        MosUtilities::MosQueryPerformanceCounter(&startTime);
+
         MOS_STATUS registStatus = RegisterPacket(packetId, iterCreator->second());
         if (MOS_FAILED(registStatus))
         {
@@ -166,8 +170,18 @@ MediaPacket *MediaPipeline::GetOrCreate(uint32_t packetId)
             MOS_STATUS status = iter->second->Init();
             if (MOS_FAILED(status))
             {
+                // Don't hand out a half initialized packet, the creator is kept so next activation retries.
                 MOS_OS_ASSERTMESSAGE("Media packet init failed!");
+                MOS_Delete(iter->second);
+                m_packetList.erase(iter);
+                return nullptr;
             }
+
+            uint64_t endTime = 0;
+            MosUtilities::MosQueryPerformanceCounter(&endTime);
+            uint64_t createTicks = endTime - startTime;
+            MOS_TraceEventExt(EVENT_PIPE_PACKET_CREATE, EVENT_TYPE_INFO, &packetId, sizeof(packetId), &createTicks, sizeof(createTicks));
+
             return iter->second;
         }
     }
@@ -201,15 +215,15 @@ MOS_STATUS MediaPipeline::ActivatePacket(uint32_t packetId, bool immediateSubmit
 
 MOS_STATUS MediaPipeline::ActivatePacket(uint32_t packetId, bool immediateSubmit, StateParams &stateProperty)
 {
-    auto iter = m_packetList.find(packetId);
-    if (iter == m_packetList.end())
+    auto packet = GetOrCreate(packetId);
+    if (packet == nullptr)
     {
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
     PacketProperty prop;
-    prop.packetId        = iter->first;
-    prop.packet          = iter->second;
+    prop.packetId        = packetId;
+    prop.packet          = packet;
     prop.immediateSubmit = immediateSubmit;
     prop.stateProperty   = stateProperty;
     MOS_TraceEventExt(EVENT_PIPE_PACKET, EVENT_TYPE_INFO, &packetId, sizeof(packetId), &stateProperty, sizeof(StateParams));
@@ -259,6 +273,20 @@ MediaTask *MediaPipeline::CreateTask(MediaTask::TaskType type)
     {
         m_taskList.emplace(type, task);
     }
+
+    // Tasks are created after user setting keys are declared by the derived pipeline.
+    // Worker pool is process wide and only grows, so later pipelines may add workers.
+    uint32_t workerThreadCount = 0;
+    ReadUserSetting(
+        m_userSettingPtr,
+        workerThreadCount,
+        "Media Worker Thread Count",
+        MediaUserSetting::Group::Sequence);
+    if (workerThreadCount > 0)
+    {
+        MediaWorkerPool::GetInstance()->SetThreadCount(workerThreadCount);
+    }
+
     return task;
 }
 
@@ -150,7 +150,7 @@ protected:
     //! \param  [in] packetId
     //!         Packet Id
     //! \return MediaPacket *
-    //!         Pointer to packet
+    //!         Pointer to packet, nullptr if packet is not registered or fails to init
     //!
     MediaPacket *GetOrCreate(uint32_t packetId);
 
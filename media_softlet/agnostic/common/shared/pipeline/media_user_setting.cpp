@@ -38,6 +38,12 @@ MOS_STATUS MediaPipeline::InitUserSetting(MediaUserSettingSharedPtr userSettingP
         MediaUserSetting::Group::Sequence,
         int32_t(1),
         false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Media Worker Thread Count",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(0),
+        false);
 
     return MOS_STATUS_SUCCESS;
 }
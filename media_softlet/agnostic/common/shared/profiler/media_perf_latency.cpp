@@ -0,0 +1,171 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_perf_latency.cpp
+//! \brief    Implements latency histograms aggregated from GPU timestamps of perf profiler.
+//!
+
+#include <stdio.h>
+#include "media_perf_latency.h"
+#include "mos_utilities.h"
+
+// Values below 16us have one bucket each, above that every power of two is
+// split into 4 buckets, so the error of a percentile is less than 25%.
+#define LATENCY_LINEAR_BUCKETS  16
+#define LATENCY_SUB_BUCKETS     4
+
+uint32_t MediaPerfLatency::ValueToBucket(uint32_t value)
+{
+    if (value < LATENCY_LINEAR_BUCKETS)
+    {
+        return value;
+    }
+
+    uint32_t msb = 0;
+    for (uint32_t v = value; v > 1; v >>= 1)
+    {
+        msb++;
+    }
+    uint32_t sub = (value >> (msb - 2)) & (LATENCY_SUB_BUCKETS - 1);
+
+    return LATENCY_LINEAR_BUCKETS + (msb - 4) * LATENCY_SUB_BUCKETS + sub;
+}
+
+uint32_t MediaPerfLatency::BucketToValue(uint32_t bucket)
+{
+    if (bucket < LATENCY_LINEAR_BUCKETS)
+    {
+        return bucket;
+    }
+
+    // Upper bound of the bucket, percentiles are reported conservatively.
+    uint32_t msb   = 4 + (bucket - LATENCY_LINEAR_BUCKETS) / LATENCY_SUB_BUCKETS;
+    uint32_t sub   = (bucket - LATENCY_LINEAR_BUCKETS) % LATENCY_SUB_BUCKETS;
+    uint64_t lower = (uint64_t)(LATENCY_SUB_BUCKETS + sub) << (msb - 2);
+    uint64_t upper = lower + ((uint64_t)1 << (msb - 2)) - 1;
+
+    return (uint32_t)MOS_MIN(upper, (uint64_t)0xffffffff);
+}
+
+void MediaPerfLatency::Histogram::Add(uint32_t value)
+{
+    bucket[ValueToBucket(value)]++;
+    count++;
+    max = MOS_MAX(max, value);
+}
+
+uint32_t MediaPerfLatency::Histogram::Percentile(uint32_t percent) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t target = (count * percent + 99) / 100;
+    uint64_t sum    = 0;
+    for (uint32_t i = 0; i < m_bucketNum; i++)
+    {
+        sum += bucket[i];
+        if (sum >= target)
+        {
+            return MOS_MIN(BucketToValue(i), max);
+        }
+    }
+
+    return max;
+}
+
+void MediaPerfLatency::AddSample(void *osContext, uint32_t gpuNode, uint32_t perfTag, uint32_t execTime, uint32_t queueTime)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Entry &entry = m_entries[Key(osContext, gpuNode, perfTag)];
+    entry.exec.Add(execTime);
+    entry.queue.Add(queueTime);
+}
+
+void MediaPerfLatency::GetStats(std::vector<Stats> &stats)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    stats.clear();
+    stats.reserve(m_entries.size());
+    for (auto &item : m_entries)
+    {
+        Stats s;
+        s.osContext = std::get<0>(item.first);
+        s.gpuNode   = std::get<1>(item.first);
+        s.perfTag   = std::get<2>(item.first);
+        s.count     = item.second.exec.count;
+        s.execP50   = item.second.exec.Percentile(50);
+        s.execP99   = item.second.exec.Percentile(99);
+        s.execMax   = item.second.exec.max;
+        s.queueP50  = item.second.queue.Percentile(50);
+        s.queueP99  = item.second.queue.Percentile(99);
+        s.queueMax  = item.second.queue.max;
+        stats.push_back(s);
+    }
+}
+
+void MediaPerfLatency::RemoveContext(void *osContext)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.lower_bound(Key(osContext, 0, 0));
+    while (it != m_entries.end() && std::get<0>(it->first) == osContext)
+    {
+        it = m_entries.erase(it);
+    }
+}
+
+MOS_STATUS MediaPerfLatency::Export(const std::string &fileName)
+{
+    std::vector<Stats> stats;
+    GetStats(stats);
+    if (stats.empty())
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint64_t    now = MosUtilities::MosGetCurTime();
+    std::string text;
+    char        line[256];
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_headerExported)
+        {
+            text += "time_us,context,gpu_node,perf_tag,count,exec_p50_us,exec_p99_us,exec_max_us,queue_p50_us,queue_p99_us,queue_max_us\n";
+            m_headerExported = true;
+        }
+    }
+
+    for (auto &s : stats)
+    {
+        snprintf(line, sizeof(line), "%llu,%p,%u,0x%x,%llu,%u,%u,%u,%u,%u,%u\n",
+            (unsigned long long)now, s.osContext, s.gpuNode, s.perfTag, (unsigned long long)s.count,
+            s.execP50, s.execP99, s.execMax, s.queueP50, s.queueP99, s.queueMax);
+        text += line;
+    }
+
+    return MosUtilities::MosAppendFileFromPtr(fileName.c_str(), (void *)text.c_str(), (uint32_t)text.size());
+}
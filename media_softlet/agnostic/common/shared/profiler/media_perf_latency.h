@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_perf_latency.h
+//! \brief    Defines latency histograms aggregated from GPU timestamps of perf profiler.
+//! \details  Each sample is the GPU execution time of one packet, bracketed by
+//!           the begin/end timestamps of MediaPerfProfiler, and its queue delay.
+//!           Samples are kept in log scale histograms per (context, GPU node,
+//!           perf tag), so memory is fixed no matter how long the process runs.
+//!
+#ifndef __MEDIA_PERF_LATENCY_H__
+#define __MEDIA_PERF_LATENCY_H__
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <stdint.h>
+#include "mos_defs.h"
+#include "media_class_trace.h"
+
+class MediaPerfLatency
+{
+public:
+    //!
+    //! \brief  Latency summary of one (context, GPU node, perf tag), in us
+    //!
+    struct Stats
+    {
+        void     *osContext   = nullptr;
+        uint32_t  gpuNode     = 0;
+        uint32_t  perfTag     = 0;
+        uint64_t  count       = 0;
+        uint32_t  execP50     = 0;
+        uint32_t  execP99     = 0;
+        uint32_t  execMax     = 0;
+        uint32_t  queueP50    = 0;  //!< Relative to the smallest queue delay seen on the context
+        uint32_t  queueP99    = 0;
+        uint32_t  queueMax    = 0;
+    };
+
+    //!
+    //! \brief  Add one sample
+    //! \param  [in] osContext
+    //!         OS context which the packet is submitted on
+    //! \param  [in] gpuNode
+    //!         PerfGPUNode of the packet
+    //! \param  [in] perfTag
+    //!         Perf tag of the packet
+    //! \param  [in] execTime
+    //!         GPU execution time in us
+    //! \param  [in] queueTime
+    //!         Queue delay in us
+    //!
+    void AddSample(void *osContext, uint32_t gpuNode, uint32_t perfTag, uint32_t execTime, uint32_t queueTime);
+
+    //!
+    //! \brief  Get summary of all histograms
+    //! \param  [out] stats
+    //!         Summary list, one entry per (context, GPU node, perf tag)
+    //!
+    void GetStats(std::vector<Stats> &stats);
+
+    //!
+    //! \brief  Drop histograms of an OS context which is destroyed
+    //! \param  [in] osContext
+    //!         OS context
+    //!
+    void RemoveContext(void *osContext);
+
+    //!
+    //! \brief  Append current summary to a csv file
+    //! \param  [in] fileName
+    //!         Name of output file
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS Export(const std::string &fileName);
+
+protected:
+    static const uint32_t m_bucketNum = 128;
+
+    struct Histogram
+    {
+        uint64_t bucket[m_bucketNum] = {};
+        uint64_t count               = 0;
+        uint32_t max                 = 0;
+
+        void     Add(uint32_t value);
+        uint32_t Percentile(uint32_t percent) const;
+    };
+
+    struct Entry
+    {
+        Histogram exec;
+        Histogram queue;
+    };
+
+    using Key = std::tuple<void *, uint32_t, uint32_t>;
+
+    static uint32_t ValueToBucket(uint32_t value);
+    static uint32_t BucketToValue(uint32_t bucket);
+
+    std::mutex           m_mutex;
+    std::map<Key, Entry> m_entries;
+    bool                 m_headerExported = false;
+
+MEDIA_CLASS_DEFINE_END(MediaPerfLatency)
+};
+
+#endif // __MEDIA_PERF_LATENCY_H__
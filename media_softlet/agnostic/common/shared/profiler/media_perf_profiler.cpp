@@ -205,6 +205,11 @@ void MediaPerfProfiler::Destroy(MediaPerfProfiler* profiler, void* context, MOS_
     CHK_NULL_NO_STATUS_RETURN(profiler);
     CHK_NULL_NO_STATUS_RETURN(osInterface);
 
+    if (profiler->m_latencyEnabled && profiler->m_mutex != nullptr)
+    {
+        profiler->DestroyLatency(context, osInterface);
+    }
+
     if (profiler->m_profilerEnabled == 0 || profiler->m_mutex == nullptr)
     {
         return;
@@ -266,6 +271,19 @@ MOS_STATUS MediaPerfProfiler::Initialize(void* context, MOS_INTERFACE *osInterfa
         __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_ENABLE,
         MediaUserSetting::Group::Device);
 
+    // Latency histograms are independent of the full profiler, so they can stay on in production
+    ReadUserSetting(
+        userSettingPtr,
+        m_latencyEnabled,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_LATENCY_ENABLE,
+        MediaUserSetting::Group::Device);
+
+    // Latency ring is optional, a context without it is simply not sampled.
+    if (m_latencyEnabled && InitializeLatency(osInterface) != MOS_STATUS_SUCCESS)
+    {
+        MOS_OS_ASSERTMESSAGE("Failed to initialize latency ring, latency is not sampled on this context!");
+    }
+
     if (m_profilerEnabled == 0 || m_mutex == nullptr)
     {
         return MOS_STATUS_SUCCESS;
@@ -463,7 +481,8 @@ MOS_STATUS MediaPerfProfiler::StoreTSByPipeCtrl(
     std::shared_ptr<mhw::mi::Itf> miItf,
     PMOS_COMMAND_BUFFER           cmdBuffer,
     MOS_CONTEXT_HANDLE            pOsContext,
-    uint32_t                      offset)
+    uint32_t                      offset,
+    PMOS_RESOURCE                 resource)
 {
     CHK_NULL_RETURN(miItf);
 
@@ -472,7 +491,7 @@ MOS_STATUS MediaPerfProfiler::StoreTSByPipeCtrl(
     PipeControlParams.dwResourceOffset = offset;
     PipeControlParams.dwPostSyncOp     = MHW_FLUSH_WRITE_TIMESTAMP_REG;
     PipeControlParams.dwFlushMode      = MHW_FLUSH_READ_CACHE;
-    PipeControlParams.presDest         = m_perfStoreBufferMap[(PMOS_CONTEXT)pOsContext];
+    PipeControlParams.presDest         = resource ? resource : m_perfStoreBufferMap[(PMOS_CONTEXT)pOsContext];
 
     CHK_STATUS_RETURN(miItf->MHW_ADDCMD_F(PIPE_CONTROL)(cmdBuffer));
 
@@ -483,7 +502,8 @@ MOS_STATUS MediaPerfProfiler::StoreTSByMiFlush(
     std::shared_ptr<mhw::mi::Itf> miItf,
     PMOS_COMMAND_BUFFER           cmdBuffer,
     MOS_CONTEXT_HANDLE            pOsContext,
-    uint32_t                      offset)
+    uint32_t                      offset,
+    PMOS_RESOURCE                 resource)
 {
     CHK_NULL_RETURN(miItf);
 
@@ -491,7 +511,7 @@ MOS_STATUS MediaPerfProfiler::StoreTSByMiFlush(
     FlushDwParams                   = {};
     FlushDwParams.postSyncOperation = MHW_FLUSH_WRITE_TIMESTAMP_REG;
     FlushDwParams.dwResourceOffset  = offset;
-    FlushDwParams.pOsResource       = m_perfStoreBufferMap[(PMOS_CONTEXT)pOsContext];
+    FlushDwParams.pOsResource       = resource ? resource : m_perfStoreBufferMap[(PMOS_CONTEXT)pOsContext];
 
     CHK_STATUS_RETURN(miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(cmdBuffer));
 
@@ -514,6 +534,11 @@ MOS_STATUS MediaPerfProfiler::AddPerfCollectStartCmd(
     PMOS_CONTEXT pOsContext = osInterface->pOsContext;
     CHK_NULL_RETURN(pOsContext);
 
+    if (m_latencyEnabled)
+    {
+        CHK_STATUS_RETURN(AddLatencyTimestampCmd(context, osInterface, miItf, cmdBuffer, true));
+    }
+
     if (m_profilerEnabled == 0 || m_initializedMap[pOsContext] == false)
     {
         return status;
@@ -636,6 +661,11 @@ MOS_STATUS MediaPerfProfiler::AddPerfCollectEndCmd(
     PMOS_CONTEXT pOsContext = osInterface->pOsContext;
     CHK_NULL_RETURN(pOsContext);
 
+    if (m_latencyEnabled)
+    {
+        CHK_STATUS_RETURN(AddLatencyTimestampCmd(context, osInterface, miItf, cmdBuffer, false));
+    }
+
     if (m_profilerEnabled == 0 || m_initializedMap[pOsContext] == false)
     {
         return status;
@@ -935,6 +965,303 @@ MOS_STATUS MediaPerfProfiler::SavePerfData(MOS_INTERFACE *osInterface)
     return status;
 }
 
+MOS_STATUS MediaPerfProfiler::InitializeLatency(MOS_INTERFACE *osInterface)
+{
+    MOS_STATUS status = MOS_STATUS_SUCCESS;
+
+    CHK_NULL_RETURN(osInterface);
+    CHK_NULL_RETURN(m_mutex);
+
+    PMOS_CONTEXT pOsContext = osInterface->pOsContext;
+    CHK_NULL_RETURN(pOsContext);
+
+    MosUtilities::MosLockMutex(m_mutex);
+
+    auto it = m_latencyRingMap.find(pOsContext);
+    if (it != m_latencyRingMap.end())
+    {
+        it->second.refCount++;
+        MosUtilities::MosUnlockMutex(m_mutex);
+        return status;
+    }
+
+    MediaUserSettingSharedPtr userSettingPtr = osInterface->pfnGetUserSettingInstance(osInterface);
+    ReadUserSetting(
+        userSettingPtr,
+        m_latencyExportInterval,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_LATENCY_EXPORT_MS,
+        MediaUserSetting::Group::Device);
+
+    if (m_latencyFileName.empty())
+    {
+        std::string outputFileName;
+        ReadUserSetting(
+            userSettingPtr,
+            outputFileName,
+            __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_OUTPUT_FILE_NAME,
+            MediaUserSetting::Group::Device);
+        m_latencyFileName = outputFileName + "-latency-" + std::to_string(MosUtilities::MosGetPid()) + ".csv";
+    }
+
+    m_timerBase = osInterface->pfnGetTsFrequency(osInterface);
+
+    LatencyRing ring;
+    ring.resource = (PMOS_RESOURCE)MOS_AllocAndZeroMemory(sizeof(MOS_RESOURCE));
+    CHK_NULL_UNLOCK_MUTEX_RETURN(ring.resource);
+
+    // Begin and end timestamp of each slot, 8 bytes aligned as required by post sync write.
+    uint32_t ringSize = m_latencySlotNum * 2 * sizeof(uint64_t);
+
+    MOS_ALLOC_GFXRES_PARAMS allocParams;
+    MOS_ZeroMemory(&allocParams, sizeof(MOS_ALLOC_GFXRES_PARAMS));
+    allocParams.Type        = MOS_GFXRES_BUFFER;
+    allocParams.TileType    = MOS_TILE_LINEAR;
+    allocParams.Format      = Format_Buffer;
+    allocParams.dwBytes     = ringSize;
+    allocParams.pBufName    = "PerfLatencyBuffer";
+
+    status = osInterface->pfnAllocateResource(osInterface, &allocParams, ring.resource);
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        MOS_FreeMemory(ring.resource);
+        MosUtilities::MosUnlockMutex(m_mutex);
+        return status;
+    }
+    osInterface->pfnSkipResourceSync(ring.resource);
+
+    // Mapped for the lifetime of the ring, so harvesting never locks on the submit path.
+    MOS_LOCK_PARAMS lockFlags;
+    MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
+    ring.data = (volatile uint64_t *)osInterface->pfnLockResource(osInterface, ring.resource, &lockFlags);
+    if (ring.data == nullptr)
+    {
+        osInterface->pfnFreeResource(osInterface, ring.resource);
+        MOS_FreeMemory(ring.resource);
+        MosUtilities::MosUnlockMutex(m_mutex);
+        return MOS_STATUS_NULL_POINTER;
+    }
+    MOS_ZeroMemory((void *)ring.data, ringSize);
+
+    ring.slots.resize(m_latencySlotNum);
+    ring.refCount = 1;
+    m_latencyRingMap.insert(std::make_pair(pOsContext, std::move(ring)));
+
+    MosUtilities::MosUnlockMutex(m_mutex);
+
+    return status;
+}
+
+void MediaPerfProfiler::DestroyLatency(void *context, MOS_INTERFACE *osInterface)
+{
+    CHK_NULL_NO_STATUS_RETURN(osInterface);
+
+    PMOS_CONTEXT pOsContext = osInterface->pOsContext;
+    CHK_NULL_NO_STATUS_RETURN(pOsContext);
+
+    MosUtilities::MosLockMutex(m_mutex);
+
+    m_latencySlotMap.erase(context);
+
+    auto it = m_latencyRingMap.find(pOsContext);
+    if (it == m_latencyRingMap.end() || --it->second.refCount > 0)
+    {
+        MosUtilities::MosUnlockMutex(m_mutex);
+        return;
+    }
+
+    osInterface->pfnWaitAllCmdCompletion(osInterface);
+    HarvestLatency(pOsContext);
+
+    LatencyRing &ring = it->second;
+    osInterface->pfnUnlockResource(osInterface, ring.resource);
+    osInterface->pfnFreeResource(osInterface, ring.resource);
+    MOS_FreeMemory(ring.resource);
+    m_latencyRingMap.erase(it);
+
+    MosUtilities::MosUnlockMutex(m_mutex);
+
+    // Histograms carry their own lock, keep file I/O out of m_mutex.
+    if (m_latencyExportInterval != 0)
+    {
+        m_latency.Export(m_latencyFileName);
+    }
+    m_latency.RemoveContext(pOsContext);
+}
+
+MOS_STATUS MediaPerfProfiler::AddLatencyTimestampCmd(
+    void                          *context,
+    MOS_INTERFACE                 *osInterface,
+    std::shared_ptr<mhw::mi::Itf> miItf,
+    MOS_COMMAND_BUFFER            *cmdBuffer,
+    bool                          isBegin)
+{
+    CHK_NULL_RETURN(osInterface);
+    CHK_NULL_RETURN(m_mutex);
+
+    PMOS_CONTEXT pOsContext = osInterface->pOsContext;
+    CHK_NULL_RETURN(pOsContext);
+
+    MOS_GPU_CONTEXT gpuContext = osInterface->pfnGetGpuContext(osInterface);
+    uint32_t        slotIndex  = 0;
+    PMOS_RESOURCE   resource   = nullptr;
+    bool            exportDue  = false;
+
+    MosUtilities::MosLockMutex(m_mutex);
+
+    auto it = m_latencyRingMap.find(pOsContext);
+    if (it == m_latencyRingMap.end())
+    {
+        MosUtilities::MosUnlockMutex(m_mutex);
+        return MOS_STATUS_SUCCESS;
+    }
+    LatencyRing &ring = it->second;
+
+    if (isBegin)
+    {
+        if (ring.next % m_latencyHarvestCount == 0)
+        {
+            exportDue = HarvestLatency(pOsContext);
+        }
+
+        // A slot still pending after a full lap means GPU is far behind, its sample is dropped.
+        slotIndex = ring.next % m_latencySlotNum;
+        ring.next++;
+
+        LatencySlot &slot = ring.slots[slotIndex];
+        slot.cpuTime      = MosUtilities::MosGetCurTime();
+        slot.perfTag      = osInterface->pfnGetPerfTag(osInterface);
+        slot.gpuNode      = GpuContextToGpuNode(gpuContext);
+        slot.pending      = true;
+        ring.data[slotIndex * 2]     = 0;
+        ring.data[slotIndex * 2 + 1] = 0;
+
+        m_latencySlotMap[context] = slotIndex;
+    }
+    else
+    {
+        auto slotIt = m_latencySlotMap.find(context);
+        if (slotIt == m_latencySlotMap.end())
+        {
+            MosUtilities::MosUnlockMutex(m_mutex);
+            return MOS_STATUS_SUCCESS;
+        }
+        slotIndex = slotIt->second;
+    }
+    resource = ring.resource;
+
+    MosUtilities::MosUnlockMutex(m_mutex);
+
+    // Export appends to a file, never do it with m_mutex held on the submit path.
+    if (exportDue)
+    {
+        m_latency.Export(m_latencyFileName);
+    }
+
+    uint32_t offset = (slotIndex * 2 + (isBegin ? 0 : 1)) * sizeof(uint64_t);
+
+    if (MOS_RCS_ENGINE_USED(gpuContext))
+    {
+        CHK_STATUS_RETURN(StoreTSByPipeCtrl(miItf, cmdBuffer, pOsContext, offset, resource));
+    }
+    else
+    {
+        CHK_STATUS_RETURN(StoreTSByMiFlush(miItf, cmdBuffer, pOsContext, offset, resource));
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+bool MediaPerfProfiler::HarvestLatency(PMOS_CONTEXT pOsContext)
+{
+    auto it = m_latencyRingMap.find(pOsContext);
+    if (it == m_latencyRingMap.end() || m_timerBase == 0)
+    {
+        return false;
+    }
+    LatencyRing &ring = it->second;
+
+    for (uint32_t i = 0; i < m_latencySlotNum; i++)
+    {
+        LatencySlot &slot = ring.slots[i];
+        if (!slot.pending)
+        {
+            continue;
+        }
+
+        uint64_t begin = ring.data[i * 2];
+        uint64_t end   = ring.data[i * 2 + 1];
+        if (begin == 0 || end == 0)
+        {
+            // Still in flight
+            continue;
+        }
+        slot.pending = false;
+
+        if (end < begin)
+        {
+            // GPU timestamp wrapped around
+            continue;
+        }
+
+        uint64_t ticks     = end - begin;
+        uint64_t execTime  = (ticks / m_timerBase) * 1000000 + (ticks % m_timerBase) * 1000000 / m_timerBase;
+        uint64_t beginTime = (begin / m_timerBase) * 1000000 + (begin % m_timerBase) * 1000000 / m_timerBase;
+
+        // CPU and GPU clocks are not correlated, so queue delay is measured against
+        // the smallest (GPU begin - CPU build) seen on the context, which is the
+        // clock offset plus the best case submit latency.
+        int64_t offset = (int64_t)beginTime - (int64_t)slot.cpuTime;
+        ring.minOffset = MOS_MIN(ring.minOffset, offset);
+        uint64_t queueTime = (uint64_t)(offset - ring.minOffset);
+
+        m_latency.AddSample(
+            pOsContext,
+            slot.gpuNode,
+            slot.perfTag,
+            (uint32_t)MOS_MIN(execTime, (uint64_t)0xffffffff),
+            (uint32_t)MOS_MIN(queueTime, (uint64_t)0xffffffff));
+    }
+
+    if (m_latencyExportInterval != 0)
+    {
+        uint64_t now = MosUtilities::MosGetCurTime();
+        if (now - m_latencyLastExport >= (uint64_t)m_latencyExportInterval * 1000)
+        {
+            m_latencyLastExport = now;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+MOS_STATUS MediaPerfProfiler::GetLatencyStats(std::vector<MediaPerfLatency::Stats> &stats)
+{
+    stats.clear();
+
+    if (m_latencyEnabled == 0 || m_mutex == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    bool exportDue = false;
+    MosUtilities::MosLockMutex(m_mutex);
+    for (auto &item : m_latencyRingMap)
+    {
+        exportDue |= HarvestLatency(item.first);
+    }
+    MosUtilities::MosUnlockMutex(m_mutex);
+
+    if (exportDue)
+    {
+        m_latency.Export(m_latencyFileName);
+    }
+
+    m_latency.GetStats(stats);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 PerfGPUNode MediaPerfProfiler::GpuContextToGpuNode(MOS_GPU_CONTEXT context)
 {
     PerfGPUNode node = PERF_GPU_NODE_UNKNOW;
@@ -30,6 +30,7 @@
 #include <unordered_map>
 #include <stdint.h>
 #include <memory>
+#include <vector>
 #include "mos_defs.h"
 #include "mos_os.h"
 #include "media_class_trace.h"
@@ -37,6 +38,7 @@
 #include "igfxfmid.h"
 #include "mos_defs_specific.h"
 #include "mos_os_specific.h"
+#include "media_perf_latency.h"
 namespace mhw
 {
     namespace mi
@@ -149,6 +151,19 @@ public:
         std::shared_ptr<mhw::mi::Itf> miItf,
         MOS_COMMAND_BUFFER *cmdBuffer);
 
+    //!
+    //! \brief    Get latency summary of packets completed so far
+    //! \details  Only available when "Perf Profiler Latency Enable" is set,
+    //!           else stats is left empty.
+    //!
+    //! \param    [out] stats
+    //!           Summary list, one entry per (context, GPU node, perf tag)
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS GetLatencyStats(std::vector<MediaPerfLatency::Stats> &stats);
+
     //!
     //! \brief    Deconstructor
     //!
@@ -221,6 +236,9 @@ private:
     //! \param    [in] offset
     //!           Offset in the buffer
     //!
+    //! \param    [in] resource
+    //!           Destination buffer, perf data buffer of pOsContext if nullptr
+    //!
     //! \return   MOS_STATUS
     //!           MOS_STATUS_SUCCESS if success, else fail reason
     //!
@@ -228,7 +246,8 @@ private:
         std::shared_ptr<mhw::mi::Itf> miItf,
         PMOS_COMMAND_BUFFER cmdBuffer,
         MOS_CONTEXT_HANDLE  pOsContext,
-        uint32_t            offset);
+        uint32_t            offset,
+        PMOS_RESOURCE       resource = nullptr);
 
     //!
     //! \brief    Save timestamp to the buffer by MI command
@@ -242,6 +261,9 @@ private:
     //! \param    [in] offset
     //!           Offset in the buffer
     //!
+    //! \param    [in] resource
+    //!           Destination buffer, perf data buffer of pOsContext if nullptr
+    //!
     //! \return   MOS_STATUS
     //!           MOS_STATUS_SUCCESS if success, else fail reason
     //!
@@ -249,7 +271,8 @@ private:
         std::shared_ptr<mhw::mi::Itf> miItf,
         PMOS_COMMAND_BUFFER cmdBuffer,
         MOS_CONTEXT_HANDLE  pOsContext,
-        uint32_t offset);
+        uint32_t offset,
+        PMOS_RESOURCE       resource = nullptr);
 
     //!
     //! \brief    Save performance data in to a file
@@ -598,6 +621,91 @@ public:
         uint32_t                       reg);
 
 private:
+    //!
+    //! \brief    Allocate latency timestamp ring of the OS context
+    //!
+    //! \param    [in] osInterface
+    //!           Pointer of OS interface
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS InitializeLatency(MOS_INTERFACE *osInterface);
+
+    //!
+    //! \brief    Fold remaining samples and free latency timestamp ring of the OS context
+    //!
+    //! \param    [in] context
+    //!           Pointer of Codechal/VPHal
+    //! \param    [in] osInterface
+    //!           Pointer of OS interface
+    //!
+    //! \return   void
+    //!
+    void DestroyLatency(void *context, MOS_INTERFACE *osInterface);
+
+    //!
+    //! \brief    Insert begin/end timestamp of latency mode
+    //!
+    //! \param    [in] context
+    //!           Pointer of Codechal/VPHal
+    //! \param    [in] osInterface
+    //!           Pointer of OS interface
+    //! \param    [in] miItf
+    //!           Reference to Mhw MiItf.
+    //! \param    [in] cmdBuffer
+    //!           Pointer of OS command buffer
+    //! \param    [in] isBegin
+    //!           Begin or end timestamp of the packet
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS AddLatencyTimestampCmd(
+        void                          *context,
+        MOS_INTERFACE                 *osInterface,
+        std::shared_ptr<mhw::mi::Itf> miItf,
+        MOS_COMMAND_BUFFER            *cmdBuffer,
+        bool                          isBegin);
+
+    //!
+    //! \brief    Fold completed slots of latency ring into histograms, m_mutex must be held
+    //!
+    //! \param    [in] pOsContext
+    //!           Pointer of DEVICE CONTEXT
+    //!
+    //! \return   bool
+    //!           true if periodic export is due, caller exports after releasing m_mutex
+    //!
+    bool HarvestLatency(PMOS_CONTEXT pOsContext);
+
+    //!
+    //! \brief    CPU side record of one latency ring slot
+    //!
+    struct LatencySlot
+    {
+        uint64_t cpuTime = 0;       //!< CPU time in us when begin timestamp command is added
+        uint32_t perfTag = 0;
+        uint32_t gpuNode = 0;
+        bool     pending = false;   //!< Waiting for GPU to write timestamps
+    };
+
+    //!
+    //! \brief    Latency timestamp ring of one OS context
+    //!
+    struct LatencyRing
+    {
+        PMOS_RESOURCE            resource   = nullptr;
+        volatile uint64_t       *data       = nullptr;  //!< Persistent mapping, begin/end timestamp pair per slot
+        std::vector<LatencySlot> slots;
+        uint32_t                 next       = 0;
+        uint32_t                 refCount   = 0;
+        int64_t                  minOffset  = INT64_MAX; //!< Smallest (GPU begin - CPU build) seen, in us
+    };
+
+    static const uint32_t m_latencySlotNum      = 256;   //!< Slots per OS context
+    static const uint32_t m_latencyHarvestCount = 16;    //!< Submits between two harvests
+
     std::unordered_map<PMOS_CONTEXT, PMOS_RESOURCE>  m_perfStoreBufferMap;   //!< Buffer for perf data collection
     std::unordered_map<PMOS_CONTEXT,uint32_t>        m_refMap;               //!< The number of refereces
     std::unordered_map<PMOS_CONTEXT,uint32_t>        m_perfDataIndexMap;     //!< The index of performance data node in buffer
@@ -627,6 +735,14 @@ private:
     uint32_t                      m_perfDataCombinedSize = 0;    //!< Combined perf data size
     uint32_t                      m_perfDataCombinedIndex = 0;   //!< Combined perf data index
     uint32_t                      m_perfDataCombinedOffset = 0;  //!< Combined perf data offset
+
+    int32_t                                     m_latencyEnabled = 0;          //!< Always on latency histograms enable or not
+    uint32_t                                    m_latencyExportInterval = 0;   //!< Export interval in ms, 0 means no export
+    uint64_t                                    m_latencyLastExport = 0;       //!< CPU time in us of last export
+    std::string                                 m_latencyFileName = "";        //!< Name of latency export file
+    std::unordered_map<PMOS_CONTEXT, LatencyRing> m_latencyRingMap;            //!< Latency timestamp ring per OS context
+    Map                                         m_latencySlotMap;              //!< Map between CodecHal/VPHal and ring slot in flight
+    MediaPerfLatency                            m_latency;                     //!< Latency histograms
 MEDIA_CLASS_DEFINE_END(MediaPerfProfiler)
 };
 
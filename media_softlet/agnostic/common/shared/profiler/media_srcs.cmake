@@ -21,11 +21,13 @@
 set(TMP_SOURCES_
     ${TMP_SOURCES_}
     ${CMAKE_CURRENT_LIST_DIR}/media_perf_profiler.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_perf_latency.cpp
 )
 
 set(TMP_HEADERS_
     ${TMP_HEADERS_}
     ${CMAKE_CURRENT_LIST_DIR}/media_perf_profiler.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_perf_latency.h
 )
 
 set(SOFTLET_COMMON_PRIVATE_INCLUDE_DIRS_
@@ -22,12 +22,14 @@ set(TMP_SOURCES_
     ${TMP_SOURCES_}
     ${CMAKE_CURRENT_LIST_DIR}/media_task.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_cmd_task.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_worker_pool.cpp
 )
 
 set(TMP_HEADERS_
     ${TMP_HEADERS_}
     ${CMAKE_CURRENT_LIST_DIR}/media_task.h
     ${CMAKE_CURRENT_LIST_DIR}/media_cmd_task.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_worker_pool.h
 )
 
 set(SOFTLET_COMMON_PRIVATE_INCLUDE_DIRS_
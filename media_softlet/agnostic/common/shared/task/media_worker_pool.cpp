@@ -0,0 +1,189 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//!
+//! \file     media_worker_pool.cpp
+//! \brief    Implements the driver owned worker pool
+//!
+
+#include "media_worker_pool.h"
+#include "mos_utilities.h"
+
+thread_local bool MediaWorkerPool::m_isWorker = false;
+
+static const uint32_t maxThreadCount = 16;
+
+MediaWorkerPool *MediaWorkerPool::GetInstance()
+{
+    static MediaWorkerPool instance;
+    return &instance;
+}
+
+MediaWorkerPool::~MediaWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeCond.notify_all();
+
+    for (auto &worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+MOS_STATUS MediaWorkerPool::SetThreadCount(uint32_t threadCount)
+{
+    threadCount = MOS_MIN(threadCount, maxThreadCount);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (m_workers.size() < threadCount)
+    {
+        try
+        {
+            m_workers.emplace_back(&MediaWorkerPool::WorkerLoop, this);
+        }
+        catch (const std::system_error &)
+        {
+            MOS_OS_ASSERTMESSAGE("Failed to create media worker thread.");
+            return m_workers.empty() ? MOS_STATUS_UNKNOWN : MOS_STATUS_SUCCESS;
+        }
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+uint32_t MediaWorkerPool::GetThreadCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (uint32_t)m_workers.size();
+}
+
+MOS_STATUS MediaWorkerPool::ParallelFor(uint32_t count, const Job &job)
+{
+    if (count == 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    // Nested parallel regions would deadlock on m_submitMutex, run them inline.
+    if (m_isWorker || count == 1 || GetThreadCount() == 0)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            MOS_STATUS status = job(i);
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return MOS_STATUS_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+
+    Batch batch;
+    batch.job   = &job;
+    batch.count = count;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batch = &batch;
+        m_batchId++;
+    }
+    m_wakeCond.notify_all();
+
+    // Caller takes jobs as well, so the batch completes even if no worker wakes up in time.
+    m_isWorker = true;
+    RunBatch(batch);
+    m_isWorker = false;
+
+    {
+        // All jobs are claimed at this point, wait for workers still running one.
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idleCond.wait(lock, [this] { return m_activeCount == 0; });
+        m_batch = nullptr;
+    }
+
+    return (MOS_STATUS)batch.status.load();
+}
+
+void MediaWorkerPool::RunBatch(Batch &batch)
+{
+    while (true)
+    {
+        uint32_t index = batch.next.fetch_add(1);
+        if (index >= batch.count)
+        {
+            break;
+        }
+
+        // Skip remaining jobs once one fails, the caller only reports the first failure.
+        if (batch.status.load() != MOS_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        MOS_STATUS status   = (*batch.job)(index);
+        int32_t    expected = MOS_STATUS_SUCCESS;
+        if (status != MOS_STATUS_SUCCESS)
+        {
+            batch.status.compare_exchange_strong(expected, (int32_t)status);
+        }
+    }
+}
+
+void MediaWorkerPool::WorkerLoop()
+{
+    m_isWorker = true;
+    MosUtilities::MosBindThreadToNumaNode();
+
+    uint64_t lastBatchId = 0;
+    while (true)
+    {
+        Batch *batch = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCond.wait(lock, [&] { return m_stop || (m_batch != nullptr && m_batchId != lastBatchId); });
+            if (m_stop)
+            {
+                break;
+            }
+            lastBatchId = m_batchId;
+            batch       = m_batch;
+            m_activeCount++;
+        }
+
+        RunBatch(*batch);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_activeCount--;
+        }
+        m_idleCond.notify_all();
+    }
+}
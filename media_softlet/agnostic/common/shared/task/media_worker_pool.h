@@ -0,0 +1,118 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//!
+//! \file     media_worker_pool.h
+//! \brief    Defines the driver owned worker pool
+//! \details  The worker pool runs independent CPU jobs of one task (per
+//!           CTB row tile address conversion, per entry LUT generation, etc.)
+//!           on a small set of driver threads. Command buffer construction is
+//!           not run on the pool, it stays on the submitting thread. The
+//!           calling thread joins the work and returns once all jobs are
+//!           done, so job order is not observable to the caller.
+//!
+#ifndef __MEDIA_WORKER_POOL_H__
+#define __MEDIA_WORKER_POOL_H__
+#include "mos_defs.h"
+#include "media_class_trace.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+class MediaWorkerPool
+{
+public:
+    using Job = std::function<MOS_STATUS(uint32_t index)>;
+
+    //!
+    //! \brief  Get process wide worker pool
+    //! \return MediaWorkerPool*
+    //!         Pointer to worker pool
+    //!
+    static MediaWorkerPool *GetInstance();
+
+    //!
+    //! \brief  Set number of worker threads
+    //! \details The pool only grows, requests smaller than current thread
+    //!          count are ignored so concurrent users never lose workers.
+    //! \param  [in] threadCount
+    //!         Number of worker threads, 0 means run all jobs on caller
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SetThreadCount(uint32_t threadCount);
+
+    //!
+    //! \brief  Get number of worker threads
+    //! \return uint32_t
+    //!
+    uint32_t GetThreadCount();
+
+    //!
+    //! \brief  Run job for each index in [0, count) and wait for completion
+    //! \details Jobs are run serially on the caller if pool has no worker,
+    //!          count is 1, or caller is a worker itself.
+    //! \param  [in] count
+    //!         Number of jobs
+    //! \param  [in] job
+    //!         Job to run, index is passed in
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if all jobs succeed, else status of first failed job
+    //!
+    MOS_STATUS ParallelFor(uint32_t count, const Job &job);
+
+    virtual ~MediaWorkerPool();
+
+protected:
+    struct Batch
+    {
+        const Job            *job    = nullptr;
+        uint32_t              count  = 0;
+        std::atomic<uint32_t> next   {0};
+        std::atomic<int32_t>  status {MOS_STATUS_SUCCESS};
+    };
+
+    MediaWorkerPool() {}
+
+    void WorkerLoop();
+    void RunBatch(Batch &batch);
+
+    std::mutex                m_mutex;
+    std::condition_variable   m_wakeCond;         //!< Signaled when a batch is posted or pool stops
+    std::condition_variable   m_idleCond;         //!< Signaled when a worker leaves the batch
+    std::vector<std::thread>  m_workers;
+    Batch                    *m_batch       = nullptr;
+    uint64_t                  m_batchId     = 0;
+    uint32_t                  m_activeCount = 0;  //!< Workers currently running m_batch
+    bool                      m_stop        = false;
+    std::mutex                m_submitMutex;      //!< Serializes batches from different callers
+
+    static thread_local bool  m_isWorker;
+
+MEDIA_CLASS_DEFINE_END(MediaWorkerPool)
+};
+
+#endif // !__MEDIA_WORKER_POOL_H__
@@ -172,9 +172,12 @@ VpResourceManager::~VpResourceManager()
         }
     }
 
-    if (m_veboxStatisticsSurface)
+    for (uint32_t i = 0; i < VP_MAX_STATISTICS_SURFACES; i++)
     {
-        m_allocator.DestroyVpSurface(m_veboxStatisticsSurface);
+        if (m_veboxStatisticsSurface[i])
+        {
+            m_allocator.DestroyVpSurface(m_veboxStatisticsSurface[i]);
+        }
     }
 
     if (m_veboxStatisticsSurfacefor1stPassofSfc2Pass)
@@ -410,6 +413,9 @@ MOS_STATUS VpResourceManager::OnNewFrameProcessStart(SwFilterPipe &pipe)
         m_currentStmmIndex  = (m_currentStmmIndex + 1) & 1;
     }
 
+    // Statistics surface is switched when first used by vebox in this frame.
+    m_statisticsIndexUpdatePending = true;
+
     m_pastFrameIds = m_currentFrameIds;
 
     m_isFcIntermediateSurfacePrepared = false;
@@ -2228,7 +2234,21 @@ MOS_STATUS VpResourceManager::AllocateVeboxResource(VP_EXECUTE_CAPS& caps, VP_SU
     }
     else
     {
-        VP_PUBLIC_CHK_STATUS_RETURN(ReAllocateVeboxStatisticsSurface(m_veboxStatisticsSurface, caps, inputSurface, dwWidth, dwHeight));
+        // HVS denoise reads statistics on CPU before current frame being submitted. With one
+        // surface, that is the output of previous frame, and the lock waits for it to complete.
+        // With N surfaces used round robin, it is the output of frame N before, which has most
+        // likely completed, so CPU preparation does not serialize with vebox execution.
+        uint32_t statisticsCount = m_vpUserFeatureControl ? m_vpUserFeatureControl->GetVeboxStatisticsFeedbackLag() : 1;
+        statisticsCount          = MOS_CLAMP_MIN_MAX(statisticsCount, 1, VP_MAX_STATISTICS_SURFACES);
+        if (statisticsCount != m_veboxStatisticsCount)
+        {
+            m_veboxStatisticsCount   = statisticsCount;
+            m_currentStatisticsIndex = 0;
+        }
+        for (uint32_t i = 0; i < m_veboxStatisticsCount; i++)
+        {
+            VP_PUBLIC_CHK_STATUS_RETURN(ReAllocateVeboxStatisticsSurface(m_veboxStatisticsSurface[i], caps, inputSurface, dwWidth, dwHeight));
+        }
     }
 
     VP_PUBLIC_CHK_STATUS_RETURN(Allocate3DLut(caps));
@@ -2636,7 +2656,12 @@ MOS_STATUS VpResourceManager::AssignVeboxResource(VP_EXECUTE_CAPS& caps, VP_SURF
     }
     else
     {
-        surfGroup.emplace(SurfaceTypeStatistics, m_veboxStatisticsSurface);
+        if (m_statisticsIndexUpdatePending)
+        {
+            m_currentStatisticsIndex       = (m_currentStatisticsIndex + 1) % m_veboxStatisticsCount;
+            m_statisticsIndexUpdatePending = false;
+        }
+        surfGroup.emplace(SurfaceTypeStatistics, m_veboxStatisticsSurface[m_currentStatisticsIndex]);
     }
     surfSetting.dwVeboxPerBlockStatisticsHeight = m_dwVeboxPerBlockStatisticsHeight;
     surfSetting.dwVeboxPerBlockStatisticsWidth  = m_dwVeboxPerBlockStatisticsWidth;
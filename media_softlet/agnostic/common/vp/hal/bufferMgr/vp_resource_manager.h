@@ -40,6 +40,7 @@
                                                                               //!< for DI: 2 for ADI plus additional 2 for parallel execution
 #define VP_NUM_DN_SURFACES           2                                       //!< Number of DN output surfaces
 #define VP_NUM_STMM_SURFACES         2                                       //!< Number of STMM statistics surfaces
+#define VP_MAX_STATISTICS_SURFACES   3                                       //!< Max number of vebox statistics surfaces, one per frame of feedback lag
 #define VP_DNDI_BUFFERS_MAX          4                                       //!< Max DNDI buffers
 #define VP_NUM_KERNEL_VEBOX          8                                       //!< Max kernels called at Adv stage
 
@@ -507,7 +508,7 @@ protected:
     VP_SURFACE* m_veboxDenoiseOutput[VP_NUM_DN_SURFACES]     = {};            //!< Vebox Denoise output surface
     VP_SURFACE* m_veboxOutput[VP_MAX_NUM_VEBOX_SURFACES]     = {};            //!< Vebox output surface, can be reuse for DI usages
     VP_SURFACE* m_veboxSTMMSurface[VP_NUM_STMM_SURFACES]     = {};            //!< Vebox STMM input/output surface
-    VP_SURFACE *m_veboxStatisticsSurface                     = nullptr;       //!< Statistics Surface for VEBOX
+    VP_SURFACE *m_veboxStatisticsSurface[VP_MAX_STATISTICS_SURFACES] = {};    //!< Statistics Surfaces for VEBOX, used round robin per frame
     VP_SURFACE *m_veboxStatisticsSurfacefor1stPassofSfc2Pass = nullptr;       //!< Statistics Surface for VEBOX for 1stPassofSfc2Pass submission
     uint32_t    m_dwVeboxPerBlockStatisticsWidth             = 0;
     uint32_t    m_dwVeboxPerBlockStatisticsHeight            = 0;
@@ -522,6 +523,9 @@ protected:
     VP_SURFACE *m_3DLutKernelCoefSurface                     = nullptr;       //!< Coef surface for 3DLut kernel.
     uint32_t    m_currentDnOutput                            = 0;
     uint32_t    m_currentStmmIndex                           = 0;
+    uint32_t    m_veboxStatisticsCount                       = 1;             //!< Statistics surfaces in use, equals to statistics feedback lag
+    uint32_t    m_currentStatisticsIndex                     = 0;
+    bool        m_statisticsIndexUpdatePending               = false;         //!< true if statistics surface not switched yet for current frame
     uint32_t    m_veboxOutputCount                           = 2;             //!< PE on: 4 used. PE off: 2 used
     bool        m_pastDnOutputValid                          = false;         //!< true if vebox DN output of previous frame valid.
     VP_FRAME_IDS m_currentFrameIds                           = {};
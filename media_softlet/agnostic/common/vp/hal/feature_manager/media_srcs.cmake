@@ -31,6 +31,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/vp_graphset.cpp
     ${CMAKE_CURRENT_LIST_DIR}/vp_graph_manager.cpp
     ${CMAKE_CURRENT_LIST_DIR}/vp_feature_manager_softlet.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/vp_frame_arena.cpp
 )
 
 set(TMP_HEADERS_
@@ -48,6 +49,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/vp_graphset.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_graph_manager.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_feature_manager_softlet.h
+    ${CMAKE_CURRENT_LIST_DIR}/vp_frame_arena.h
 )
 
 set(SOFTLET_VP_SOURCES_
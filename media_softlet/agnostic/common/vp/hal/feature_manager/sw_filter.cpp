@@ -2371,7 +2371,7 @@ MOS_STATUS SwFilterAiBase::Update(VP_SURFACE *inputSurf, VP_SURFACE *outputSurf,
 /*                                      SwFilterSet                                                 */
 /****************************************************************************************************/
 
-SwFilterSet::SwFilterSet()
+SwFilterSet::SwFilterSet(VpFrameArena *arena) : m_swFilters(VpFrameArenaAllocator<std::pair<const FeatureType, SwFilter *>>(arena))
 {}
 SwFilterSet::~SwFilterSet()
 {
@@ -2450,13 +2450,13 @@ SwFilter *SwFilterSet::GetSwFilter(FeatureType type)
     return it->second;
 }
 
-std::vector<SwFilterSet *> *SwFilterSet::GetLocation()
+SwFilterSetList *SwFilterSet::GetLocation()
 {
     VP_FUNC_CALL();
 
     return m_location;
 }
-void SwFilterSet::SetLocation(std::vector<SwFilterSet *> *location)
+void SwFilterSet::SetLocation(SwFilterSetList *location)
 {
     VP_FUNC_CALL();
 
@@ -37,6 +37,7 @@
 #include "media_sfc_interface.h"
 #include "surface_type.h"
 #include "vp_ai_kernel_pipe.h"
+#include "vp_frame_arena.h"
 
 namespace vp
 {
@@ -1172,10 +1173,12 @@ protected:
 MEDIA_CLASS_DEFINE_END(vp__SwFilterAiBase)
 };
 
+using SwFilterSetList = std::vector<SwFilterSet *, VpFrameArenaAllocator<SwFilterSet *>>;
+
 class SwFilterSet
 {
 public:
-    SwFilterSet();
+    SwFilterSet(VpFrameArena *arena = nullptr);
     virtual ~SwFilterSet();
 
     MOS_STATUS AddSwFilter(SwFilter *swFilter);
@@ -1189,16 +1192,17 @@ public:
         return m_swFilters.empty();
     }
 
-    std::vector<class SwFilterSet *> *GetLocation();
-    void SetLocation(std::vector<class SwFilterSet *> *location);
+    SwFilterSetList *GetLocation();
+    void SetLocation(SwFilterSetList *location);
     RenderTargetType                  GetRenderTargetType();
 
     MOS_STATUS GetAiSwFilter(SwFilterAiBase *&swAiFilter);
 
 private:
-    std::map<FeatureType, SwFilter *> m_swFilters;
+    // Nodes are allocated from frame arena of the owner sub pipe.
+    std::map<FeatureType, SwFilter *, std::less<FeatureType>, VpFrameArenaAllocator<std::pair<const FeatureType, SwFilter *>>> m_swFilters;
     // nullptr if it is unordered filters, otherwise, it's the pointer to m_OrderedFilters it belongs to.
-    std::vector<class SwFilterSet *> *m_location = nullptr;
+    SwFilterSetList *m_location = nullptr;
 
 MEDIA_CLASS_DEFINE_END(vp__SwFilterSet)
 };
@@ -37,7 +37,10 @@ using namespace vp;
 /*                                      SwFilterSubPipe                                             */
 /****************************************************************************************************/
 
-SwFilterSubPipe::SwFilterSubPipe()
+SwFilterSubPipe::SwFilterSubPipe(VpFrameArena &arena) :
+    m_arena(arena),
+    m_OrderedFilters(VpFrameArenaAllocator<SwFilterSet *>(&arena)),
+    m_UnorderedFilters(&arena)
 {
 }
 
@@ -56,7 +59,7 @@ MOS_STATUS SwFilterSubPipe::Clean()
         {
             // Loop orderred feature set.
             VP_PUBLIC_CHK_STATUS_RETURN(filterSet->Clean());
-            MOS_Delete(filterSet);
+            m_arena.Destroy(filterSet);
         }
     }
     m_OrderedFilters.clear();
@@ -135,7 +138,7 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
 
     if (useNewSwFilterSet || pipe.empty())
     {
-        swFilterSet = MOS_New(SwFilterSet);
+        swFilterSet = m_arena.Create<SwFilterSet>(&m_arena);
         useNewSwFilterSet = true;
     }
     else
@@ -150,7 +153,7 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
     {
         if (useNewSwFilterSet)
         {
-            MOS_Delete(swFilterSet);
+            m_arena.Destroy(swFilterSet);
         }
         return status;
     }
@@ -260,7 +263,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_linkedLayerIndex.push_back(0);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -286,7 +289,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_OutputSurfaces.push_back(surf);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -338,7 +341,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_linkedLayerIndex.push_back(0);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -369,7 +372,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_OutputSurfaces.push_back(output);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -429,7 +432,7 @@ MOS_STATUS SwFilterPipe::Clean()
         while (!pipe->empty())
         {
             auto p = pipe->back();
-            MOS_Delete(p);
+            DestroySubPipe(p);
             pipe->pop_back();
         }
     }
@@ -451,6 +454,17 @@ MOS_STATUS SwFilterPipe::Clean()
     return MOS_STATUS_SUCCESS;
 }
 
+SwFilterSubPipe *SwFilterPipe::CreateSubPipe()
+{
+    VpFrameArena &arena = m_vpInterface.GetFrameArena();
+    return arena.Create<SwFilterSubPipe>(arena);
+}
+
+void SwFilterPipe::DestroySubPipe(SwFilterSubPipe *&pipe)
+{
+    m_vpInterface.GetFrameArena().Destroy(pipe);
+}
+
 bool SwFilterPipe::IsEmpty()
 {
     VP_FUNC_CALL();
@@ -768,7 +782,7 @@ MOS_STATUS SwFilterPipe::AddSwFilterUnordered(SwFilter *swFilter, bool isInputPi
     if (nullptr == pSubPipe && !isInputPipe)
     {
         auto& pipes = m_OutputPipes;
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         if ((size_t)index <= pipes.size())
         {
@@ -815,7 +829,7 @@ MOS_STATUS SwFilterPipe::RemoveSwFilter(SwFilter *swFilter)
         }
         swFilterSet->SetLocation(nullptr);
 
-        MOS_Delete(swFilterSet);
+        m_vpInterface.GetFrameArena().Destroy(swFilterSet);
     }
     return MOS_STATUS_SUCCESS;
 }
@@ -995,7 +1009,7 @@ MOS_STATUS SwFilterPipe::AddSurface(VP_SURFACE *&surf, bool isInputSurface, uint
 
     if (nullptr == pipes[index])
     {
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         pipes[index] = pipe;
     }
@@ -1045,7 +1059,7 @@ MOS_STATUS RemoveUnusedLayers(std::vector<uint32_t> &indexForRemove, std::vector
 }
 
 template<class T>
-MOS_STATUS RemoveUnusedLayers(std::vector<uint32_t> &indexForRemove, std::vector<T*> &layers, bool freeObj)
+MOS_STATUS RemoveUnusedLayers(std::vector<uint32_t> &indexForRemove, std::vector<T*> &layers, bool freeObj, VpFrameArena *arena = nullptr)
 {
     VP_FUNC_CALL();
 
@@ -1068,7 +1082,14 @@ MOS_STATUS RemoveUnusedLayers(std::vector<uint32_t> &indexForRemove, std::vector
         }
         for (auto it : objForRemove)
         {
-            MOS_Delete(it.second);
+            if (arena)
+            {
+                arena->Destroy(it.second);
+            }
+            else
+            {
+                MOS_Delete(it.second);
+            }
         }
     }
 
@@ -1110,7 +1131,7 @@ MOS_STATUS SwFilterPipe::RemoveUnusedLayers(bool bUpdateInput)
         VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, m_linkedLayerIndex));
     }
 
-    VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, pipes, true));
+    VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, pipes, true, &m_vpInterface.GetFrameArena()));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -65,7 +65,7 @@ struct FeatureRule
 class SwFilterSubPipe
 {
 public:
-    SwFilterSubPipe();
+    SwFilterSubPipe(VpFrameArena &arena);
     virtual ~SwFilterSubPipe();
     MOS_STATUS Clean();
     MOS_STATUS Update(VP_SURFACE *inputSurf, VP_SURFACE *outputSurf);
@@ -108,7 +108,8 @@ public:
     MOS_STATUS GetAiSwFilter(SwFilterAiBase *&swAiFilter);
 
 private:
-    std::vector<SwFilterSet *> m_OrderedFilters;    // For features in featureRule
+    VpFrameArena &m_arena;                          // Frame arena for filter sets and containers
+    SwFilterSetList m_OrderedFilters;               // For features in featureRule
     SwFilterSet m_UnorderedFilters;                 // For features not in featureRule
 
 MEDIA_CLASS_DEFINE_END(vp__SwFilterSubPipe)
@@ -262,6 +263,8 @@ protected:
     MOS_STATUS CleanFeaturesFromPipe(bool isInputPipe);
     MOS_STATUS CleanFeatures();
     MOS_STATUS RemoveUnusedLayers(bool bUpdateInput);
+    SwFilterSubPipe *CreateSubPipe();
+    void DestroySubPipe(SwFilterSubPipe *&pipe);
 
     std::vector<SwFilterSubPipe *>      m_InputPipes;       // For features on input surfaces.
     std::vector<SwFilterSubPipe *>      m_OutputPipes;      // For features on output surfaces.
@@ -0,0 +1,165 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//!
+//! \file     vp_frame_arena.cpp
+//! \brief    Implements the frame scoped bump allocator for vp feature manager objects
+//!
+#include "vp_frame_arena.h"
+#include "vp_utils.h"
+
+using namespace vp;
+
+static const size_t arenaAlignment    = 16;
+static const size_t arenaMinChunkSize = 0x4000;    // 16KB
+static const size_t arenaMaxChunkSize = 0x100000;  // 1MB
+
+VpFrameArena::VpFrameArena() : m_chunkSize(arenaMinChunkSize)
+{
+}
+
+VpFrameArena::~VpFrameArena()
+{
+    if (m_liveCount != 0)
+    {
+        VP_PUBLIC_ASSERTMESSAGE("%d frame arena allocations are not freed before destroy", m_liveCount);
+    }
+    FreeChunks();
+}
+
+void *VpFrameArena::Allocate(size_t size)
+{
+    size = MOS_ALIGN_CEIL(MOS_MAX(size, (size_t)1), arenaAlignment);
+
+    if (m_chunks.empty() || m_chunks.back().used + size > m_chunks.back().size)
+    {
+        if (MOS_FAILED(AddChunk(size)))
+        {
+            return nullptr;
+        }
+    }
+
+    Chunk &chunk = m_chunks.back();
+    void  *ptr   = chunk.base + chunk.used;
+    chunk.used += size;
+
+    m_liveCount++;
+    m_frameAllocCount++;
+    m_frameAllocBytes += size;
+
+    return ptr;
+}
+
+void VpFrameArena::Free(void *ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    VP_PUBLIC_ASSERT(m_liveCount > 0);
+    if (m_liveCount > 0)
+    {
+        m_liveCount--;
+    }
+}
+
+bool VpFrameArena::Contains(const void *ptr) const
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    for (auto &chunk : m_chunks)
+    {
+        if (p >= chunk.base && p < chunk.base + chunk.size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+MOS_STATUS VpFrameArena::EndFrame()
+{
+    m_stats.frameCount++;
+    m_stats.frameAllocCount = m_frameAllocCount;
+    m_stats.frameAllocBytes = (uint32_t)m_frameAllocBytes;
+    m_stats.frameHeapCount  = m_frameHeapCount;
+    m_stats.peakFrameBytes  = MOS_MAX(m_stats.peakFrameBytes, m_stats.frameAllocBytes);
+
+    m_frameAllocCount = 0;
+    m_frameAllocBytes = 0;
+    m_frameHeapCount  = 0;
+
+    if (m_liveCount == 0)
+    {
+        if (m_chunks.size() > 1)
+        {
+            // Frame spilled into several chunks, replace them with one chunk
+            // of the total size so that next frame is served by one chunk.
+            size_t totalSize = 0;
+            for (auto &chunk : m_chunks)
+            {
+                totalSize += chunk.size;
+            }
+            FreeChunks();
+            m_chunkSize = totalSize;
+        }
+        else if (m_chunks.size() == 1)
+        {
+            m_chunks[0].used = 0;
+        }
+    }
+    else
+    {
+        // Some objects outlive the frame, keep their memory and rewind later.
+        m_stats.deferredResetCount++;
+    }
+
+    size_t reservedBytes = 0;
+    for (auto &chunk : m_chunks)
+    {
+        reservedBytes += chunk.size;
+    }
+    m_stats.reservedBytes = (uint32_t)reservedBytes;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpFrameArena::AddChunk(size_t minSize)
+{
+    Chunk chunk = {};
+    chunk.size  = MOS_MAX(m_chunkSize, minSize);
+    chunk.base  = (uint8_t *)MOS_AlignedAllocMemory(chunk.size, arenaAlignment);
+    VP_PUBLIC_CHK_NULL_RETURN(chunk.base);
+
+    m_chunks.push_back(chunk);
+    m_chunkSize = MOS_MIN(MOS_MAX(m_chunkSize * 2, chunk.size), arenaMaxChunkSize);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void VpFrameArena::FreeChunks()
+{
+    for (auto &chunk : m_chunks)
+    {
+        MOS_AlignedFreeMemory(chunk.base);
+    }
+    m_chunks.clear();
+}
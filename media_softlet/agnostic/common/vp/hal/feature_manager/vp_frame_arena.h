@@ -0,0 +1,253 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//!
+//! \file     vp_frame_arena.h
+//! \brief    Frame scoped bump allocator for vp feature manager objects
+//! \details  SwFilterSubPipe and SwFilterSet objects, together with the
+//!           containers inside them, are created and destroyed on every frame.
+//!           VpFrameArena serves them from a few large chunks which are
+//!           rewound once the frame is done, instead of one heap allocation
+//!           per object and per container node.
+//!
+//!           Destroy only runs the destructor, the memory is reclaimed by
+//!           EndFrame when nothing allocated from the arena is alive any more.
+//!           If objects outlive the frame, the rewind is deferred until they
+//!           are gone, so pointers into the arena never dangle. The arena is
+//!           used by the thread executing the owning vp pipeline only.
+//!
+#ifndef __VP_FRAME_ARENA_H__
+#define __VP_FRAME_ARENA_H__
+
+#include <new>
+#include <utility>
+#include <vector>
+#include "mos_utilities.h"
+#include "media_class_trace.h"
+
+namespace vp
+{
+
+class VpFrameArena
+{
+public:
+    //!
+    //! \brief  Allocation statistics of last ended frame
+    //!
+    struct Statistics
+    {
+        uint64_t frameCount         = 0;  //!< Frames ended so far
+        uint32_t frameAllocCount    = 0;  //!< Allocations served by arena in last frame
+        uint32_t frameAllocBytes    = 0;  //!< Bytes served by arena in last frame
+        uint32_t frameHeapCount     = 0;  //!< Allocations falling back to heap in last frame
+        uint32_t peakFrameBytes     = 0;  //!< Max of frameAllocBytes so far
+        uint32_t reservedBytes      = 0;  //!< Bytes of all chunks held by arena
+        uint32_t deferredResetCount = 0;  //!< Frames ended with allocations still alive
+    };
+
+    VpFrameArena();
+
+    virtual ~VpFrameArena();
+
+    //!
+    //! \brief  Allocate memory from current frame
+    //! \param  [in] size
+    //!         Size in bytes
+    //! \return void*
+    //!         Memory aligned to 16 bytes, nullptr if out of memory
+    //!
+    void *Allocate(size_t size);
+
+    //!
+    //! \brief  Give back memory allocated by Allocate
+    //! \details The memory is reused after EndFrame once all allocations are freed.
+    //! \param  [in] ptr
+    //!         Memory to free
+    //!
+    void Free(void *ptr);
+
+    //!
+    //! \brief  Check if memory belongs to arena
+    //! \param  [in] ptr
+    //!         Memory to check
+    //! \return bool
+    //!         true if ptr is allocated by arena
+    //!
+    bool Contains(const void *ptr) const;
+
+    //!
+    //! \brief  Update statistics of the frame and rewind arena if possible
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS EndFrame();
+
+    //!
+    //! \brief  Get allocation statistics
+    //! \return Statistics
+    //!
+    Statistics GetStatistics() const
+    {
+        return m_stats;
+    }
+
+    //!
+    //! \brief  Count one allocation falling back to heap
+    //!
+    void AddHeapAlloc()
+    {
+        m_frameHeapCount++;
+    }
+
+    //!
+    //! \brief  Construct object in arena, or on heap if arena is exhausted
+    //! \param  [in] args
+    //!         Arguments of constructor
+    //! \return T*
+    //!         Pointer to object, nullptr if out of memory
+    //!
+    template <class T, class... Args>
+    T *Create(Args &&... args)
+    {
+        void *mem = Allocate(sizeof(T));
+        if (mem == nullptr)
+        {
+            AddHeapAlloc();
+            return MOS_New(T, std::forward<Args>(args)...);
+        }
+        return new (mem) T(std::forward<Args>(args)...);
+    }
+
+    //!
+    //! \brief  Destroy object created by Create
+    //! \param  [in, out] obj
+    //!         Object to destroy, set to nullptr on return
+    //!
+    template <class T>
+    void Destroy(T *&obj)
+    {
+        if (obj == nullptr)
+        {
+            return;
+        }
+        if (Contains(obj))
+        {
+            obj->~T();
+            Free(obj);
+        }
+        else
+        {
+            MOS_Delete(obj);
+        }
+        obj = nullptr;
+    }
+
+protected:
+    struct Chunk
+    {
+        uint8_t *base = nullptr;
+        size_t   size = 0;
+        size_t   used = 0;
+    };
+
+    MOS_STATUS AddChunk(size_t minSize);
+    void       FreeChunks();
+
+    std::vector<Chunk> m_chunks;
+    size_t             m_chunkSize       = 0;  //!< Size of next chunk to add
+    uint32_t           m_liveCount       = 0;  //!< Allocations not freed yet
+    uint32_t           m_frameAllocCount = 0;
+    size_t             m_frameAllocBytes = 0;
+    uint32_t           m_frameHeapCount  = 0;
+    Statistics         m_stats           = {};
+
+MEDIA_CLASS_DEFINE_END(vp__VpFrameArena)
+};
+
+//!
+//! \brief  STL allocator on VpFrameArena, falls back to heap if arena is nullptr or exhausted
+//!
+template <class T>
+class VpFrameArenaAllocator
+{
+public:
+    using value_type = T;
+
+    VpFrameArenaAllocator(VpFrameArena *arena = nullptr) : m_arena(arena)
+    {
+    }
+
+    template <class U>
+    VpFrameArenaAllocator(const VpFrameArenaAllocator<U> &other) : m_arena(other.GetArena())
+    {
+    }
+
+    T *allocate(size_t n)
+    {
+        void *mem = m_arena ? m_arena->Allocate(n * sizeof(T)) : nullptr;
+        if (mem == nullptr)
+        {
+            if (m_arena)
+            {
+                m_arena->AddHeapAlloc();
+            }
+            mem = ::operator new(n * sizeof(T));
+        }
+        return static_cast<T *>(mem);
+    }
+
+    void deallocate(T *p, size_t n)
+    {
+        if (m_arena && m_arena->Contains(p))
+        {
+            m_arena->Free(p);
+        }
+        else
+        {
+            ::operator delete(p);
+        }
+    }
+
+    VpFrameArena *GetArena() const
+    {
+        return m_arena;
+    }
+
+    template <class U>
+    bool operator==(const VpFrameArenaAllocator<U> &other) const
+    {
+        return m_arena == other.GetArena();
+    }
+
+    template <class U>
+    bool operator!=(const VpFrameArenaAllocator<U> &other) const
+    {
+        return m_arena != other.GetArena();
+    }
+
+private:
+    VpFrameArena *m_arena = nullptr;
+};
+
+}  // namespace vp
+
+#endif  // !__VP_FRAME_ARENA_H__
@@ -30,6 +30,7 @@
 #include "hal_oca_interface_next.h"
 #include "vp_user_feature_control.h"
 #include "vp_hal_ddi_utils.h"
+#include "media_worker_pool.h"
 
 using namespace vp;
 
@@ -1356,6 +1357,29 @@ void HdrGenerate2SegmentsOETFLUT(float fStretchFactor, pfnOETFFunc oetfFunc, uin
     }
 }
 
+//!
+//! \brief    Get OETF LUT of inverse tone mapping
+//! \details  The LUT only depends on constants, so it is generated once per process
+//!           instead of on every OETF 1D LUT update.
+//! \return   const uint16_t*
+//!           Pointer to VPHAL_HDR_OETF_1DLUT_POINT_NUMBER half float entries
+//!
+static const uint16_t *HdrGetInverseToneMappingOETFLUT()
+{
+    struct OETFLUT
+    {
+        OETFLUT()
+        {
+            const float fStretchFactor = 0.01f;
+            HdrGenerate2SegmentsOETFLUT(fStretchFactor, HdrOETF2084, data);
+        }
+        uint16_t data[VPHAL_HDR_OETF_1DLUT_POINT_NUMBER];
+    };
+    static const OETFLUT lut;
+
+    return lut.data;
+}
+
 //!
 //! \brief    Color Transfer for Hdr 3d Lut
 //! \details  Color Transfer for Hdr 3d Lut
@@ -1387,8 +1411,7 @@ MOS_STATUS VpRenderHdrKernel::VpHal_HdrColorTransfer3dLut(
     uint16_t        *puOutputY,
     uint16_t        *puOutputZ)
 {
-    VP_FUNC_CALL();
-
+    // No function trace here, it is called per 3D LUT entry from worker threads.
     float                PriorCscMatrix[12] = {}, PostCscMatrix[12] = {};
     float                TempMatrix[12] = {};
     double               fTempX = 0, fTempY = 0, fTempZ = 0;
@@ -1832,15 +1855,6 @@ MOS_STATUS VpRenderHdrKernel::VpHal_HdrColorTransfer3dLut(
 #undef SET_MATRIX
 #undef CLAMP_MIN_MAX
 
-    if (params->bGpuGenerate3DLUT)
-    {
-        params->f3DLUTNormalizationFactor = 1023.0f;
-    }
-    else
-    {
-        params->f3DLUTNormalizationFactor = 65535.0f;
-    }
-
     // Convert and round up the [0, 1] float color value to 16 bit integer value
     *puOutputX = (uint16_t)(fTempX * params->f3DLUTNormalizationFactor + 0.5f);
     *puOutputY = (uint16_t)(fTempY * params->f3DLUTNormalizationFactor + 0.5f);
@@ -2032,8 +2046,7 @@ MOS_STATUS VpRenderHdrKernel::InitOETF1DLUT(
     {
         if (params->HdrMode[iIndex] == VPHAL_HDR_MODE_INVERSE_TONE_MAPPING)
         {
-            const float fStretchFactor = 0.01f;
-            HdrGenerate2SegmentsOETFLUT(fStretchFactor, HdrOETF2084, params->OetfSmpteSt2084);
+            MOS_SecureMemcpy(params->OetfSmpteSt2084, sizeof(params->OetfSmpteSt2084), HdrGetInverseToneMappingOETFLUT(), sizeof(params->OetfSmpteSt2084));
             pSrcOetfLut = params->OetfSmpteSt2084;
         }
         else  // params->HdrMode[iIndex] == VPHAL_HDR_MODE_H2H
@@ -2061,9 +2074,127 @@ MOS_STATUS VpRenderHdrKernel::InitOETF1DLUT(
     return eStatus;
 }
 
+//!
+//! \brief    Inputs of VpHal_HdrColorTransfer3dLut which decide content of Cri 3D LUT
+//! \details  Zeroed before being filled, so that it can be hashed and compared bytewise.
+//!
+struct HdrCri3DLutKey
+{
+    MOS_FORMAT         format;
+    uint32_t           lutSize;
+    uint16_t           stageEnables;
+    bool               ayuvInput;
+    bool               gpuGenerate3DLUT;
+    VPHAL_HDR_CSC_TYPE priorCSC;
+    VPHAL_GAMMA_TYPE   eotfGamma;
+    VPHAL_HDR_CCM_TYPE ccm;
+    VPHAL_HDR_MODE     hdrMode;
+    VPHAL_HDR_CCM_TYPE ccmExt1;
+    VPHAL_HDR_CCM_TYPE ccmExt2;
+    VPHAL_GAMMA_TYPE   oetfGamma;
+    VPHAL_HDR_CSC_TYPE postCSC;
+    uint16_t           targetPrimariesX[3];  //!< Target gamut, used by monitor CCM
+    uint16_t           targetPrimariesY[3];
+    uint16_t           targetWhitePointX;
+    uint16_t           targetWhitePointY;
+};
+
+//!
+//! \brief    Process wide cache of generated Cri 3D LUTs
+//! \details  HDR kernel objects are created per render pass, while the LUT only
+//!           changes with layer and target HDR configuration. A few recently used
+//!           LUTs are kept, tightly packed, so that an update with known
+//!           configuration (e.g. auto mode, or switching between streams) is a copy.
+//!
+class HdrCri3DLutCache
+{
+public:
+    static HdrCri3DLutCache &GetInstance()
+    {
+        static HdrCri3DLutCache cache;
+        return cache;
+    }
+
+    bool Lookup(const HdrCri3DLutKey &key, uint8_t *dst, uint32_t pitch, uint32_t rowBytes, uint32_t rowCount)
+    {
+        uint32_t                    hash = Hash(key);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto &entry : m_entries)
+        {
+            if (entry.lut.empty() || entry.hash != hash || memcmp(&entry.key, &key, sizeof(key)) != 0)
+            {
+                continue;
+            }
+            for (uint32_t row = 0; row < rowCount; row++)
+            {
+                MOS_SecureMemcpy(dst + row * pitch, rowBytes, entry.lut.data() + row * rowBytes, rowBytes);
+            }
+            entry.lastUse = ++m_useCount;
+            return true;
+        }
+        return false;
+    }
+
+    void Insert(const HdrCri3DLutKey &key, std::vector<uint8_t> &lut)
+    {
+        uint32_t                    hash = Hash(key);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Replace empty or least recently used entry.
+        Entry *victim = &m_entries[0];
+        for (auto &entry : m_entries)
+        {
+            if (entry.lut.empty())
+            {
+                victim = &entry;
+                break;
+            }
+            if (entry.lastUse < victim->lastUse)
+            {
+                victim = &entry;
+            }
+        }
+        MOS_SecureMemcpy(&victim->key, sizeof(victim->key), &key, sizeof(key));
+        victim->hash    = hash;
+        victim->lastUse = ++m_useCount;
+        victim->lut.swap(lut);
+    }
+
+private:
+    struct Entry
+    {
+        HdrCri3DLutKey       key     = {};
+        uint32_t             hash    = 0;
+        uint64_t             lastUse = 0;
+        std::vector<uint8_t> lut;
+    };
+
+    static uint32_t Hash(const HdrCri3DLutKey &key)
+    {
+        // FNV-1a, only used to skip memcmp of mismatched entries.
+        const uint8_t *data = (const uint8_t *)&key;
+        uint32_t       hash = 2166136261u;
+        for (uint32_t i = 0; i < sizeof(key); i++)
+        {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    static const uint32_t m_entryNum = 4;
+
+    std::mutex m_mutex;
+    Entry      m_entries[m_entryNum];
+    uint64_t   m_useCount = 0;
+};
+
 //!
 //! \brief    Initiate Cri 3D Lut Surface for HDR
-//! \details  Initiate Cri 3D Lut Surface for HDR
+//! \details  Initiate Cri 3D Lut Surface for HDR. The LUT is taken from process
+//!           wide cache if generated before with same configuration, otherwise
+//!           it is generated into system memory with one job per LUT slice on
+//!           media worker pool, and then copied to the surface.
 //! \param    PVPHAL_HDR_STATE pHdrStatee
 //!           [in] Pointer to HDR state
 //! \param    int32_t iIndex
@@ -2079,106 +2210,136 @@ MOS_STATUS VpRenderHdrKernel::InitCri3DLUT(
 {
     VP_FUNC_CALL();
 
-    MOS_STATUS      eStatus = MOS_STATUS_SUCCESS;
-    uint32_t        i = 0, j = 0, k = 0;
-    uint16_t        u3dLutOutputX = 0, u3dLutOutputY = 0, u3dLutOutputZ = 0;
-    uint16_t       *pwDst3dLut = nullptr;
-    uint32_t       *puiDst3dLut = nullptr;
-    uint8_t        *pByte = nullptr;
+    uint8_t        *pByte         = nullptr;
     MOS_LOCK_PARAMS LockFlags     = {};
-    uint8_t         bBytePerPixel = 0;
+    uint32_t        bBytePerPixel = 0;
+    HdrCri3DLutKey  key;
 
+    VP_PUBLIC_CHK_NULL_RETURN(params);
     VP_PUBLIC_CHK_NULL_RETURN(pCRI3DLUTSurface);
     VP_PUBLIC_CHK_NULL_RETURN(pCRI3DLUTSurface->osSurface);
 
-    MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
+    PMOS_SURFACE osSurface = pCRI3DLUTSurface->osSurface;
+    if (osSurface->Format == Format_A16B16G16R16)
+    {
+        bBytePerPixel = 8;
+    }
+    else if (osSurface->Format == Format_R10G10B10A2)
+    {
+        bBytePerPixel = 4;
+    }
+    else
+    {
+        VP_RENDER_ASSERTMESSAGE("Unexpected HDR 3DLUT format.");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    uint32_t lutSize  = params->Cri3DLUTSize;
+    uint32_t rowBytes = lutSize * bBytePerPixel;
+    uint32_t rowCount = lutSize * lutSize;
+    if (rowBytes > osSurface->dwPitch)
+    {
+        VP_RENDER_ASSERTMESSAGE("HDR 3DLUT surface pitch is too small.");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    // Set once here instead of per entry, as entries are generated concurrently.
+    params->f3DLUTNormalizationFactor = params->bGpuGenerate3DLUT ? 1023.0f : 65535.0f;
+
+    auto        inputSurface = m_surfaceGroup->find(SurfaceType(SurfaceTypeHdrInputLayer0 + iIndex));
+    VP_SURFACE *input        = (m_surfaceGroup->end() != inputSurface) ? inputSurface->second : nullptr;
+
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.format            = osSurface->Format;
+    key.lutSize           = lutSize;
+    key.stageEnables      = params->StageEnableFlags[iIndex].value;
+    key.ayuvInput         = input && input->osSurface && input->osSurface->Format == Format_AYUV;
+    key.gpuGenerate3DLUT  = params->bGpuGenerate3DLUT;
+    key.priorCSC          = params->PriorCSC[iIndex];
+    key.eotfGamma         = params->EOTFGamma[iIndex];
+    key.ccm               = params->CCM[iIndex];
+    key.hdrMode           = params->HdrMode[iIndex];
+    key.ccmExt1           = params->CCMExt1[iIndex];
+    key.ccmExt2           = params->CCMExt2[iIndex];
+    key.oetfGamma         = params->OETFGamma[iIndex];
+    key.postCSC           = params->PostCSC[iIndex];
+    key.targetWhitePointX = params->targetHDRParams[0].white_point_x;
+    key.targetWhitePointY = params->targetHDRParams[0].white_point_y;
+    for (uint32_t c = 0; c < 3; c++)
+    {
+        key.targetPrimariesX[c] = params->targetHDRParams[0].display_primaries_x[c];
+        key.targetPrimariesY[c] = params->targetHDRParams[0].display_primaries_y[c];
+    }
 
     LockFlags.WriteOnly = 1;
 
     // Lock the surface for writing
     pByte = (uint8_t *)m_allocator->Lock(
-        &(pCRI3DLUTSurface->osSurface->OsResource),
+        &(osSurface->OsResource),
         &LockFlags);
 
     VP_PUBLIC_CHK_NULL_RETURN(pByte);
 
-    if (pCRI3DLUTSurface->osSurface->Format == Format_A16B16G16R16)
+    if (HdrCri3DLutCache::GetInstance().Lookup(key, pByte, osSurface->dwPitch, rowBytes, rowCount))
     {
-        bBytePerPixel = 8;
-
-        for (i = 0; i < params->Cri3DLUTSize; i++)
-        {
-            for (j = 0; j < params->Cri3DLUTSize; j++)
-            {
-                for (k = 0; k < params->Cri3DLUTSize; k++)
-                {
-                    pwDst3dLut = (uint16_t *)(pByte +
-                                              i * params->Cri3DLUTSize * pCRI3DLUTSurface->osSurface->dwPitch +
-                                              j * pCRI3DLUTSurface->osSurface->dwPitch +
-                                              k * bBytePerPixel);
-
-                    u3dLutOutputX = u3dLutOutputY = u3dLutOutputZ = 0;
-
-                    VpHal_HdrColorTransfer3dLut(params,
-                        iIndex,
-                        (float)k / (float)(params->Cri3DLUTSize - 1),
-                        (float)j / (float)(params->Cri3DLUTSize - 1),
-                        (float)i / (float)(params->Cri3DLUTSize - 1),
-                        &u3dLutOutputX,
-                        &u3dLutOutputY,
-                        &u3dLutOutputZ);
+        VP_PUBLIC_CHK_STATUS_RETURN(m_allocator->UnLock(&osSurface->OsResource));
+        return MOS_STATUS_SUCCESS;
+    }
 
-                    *pwDst3dLut++ = u3dLutOutputX;
-                    *pwDst3dLut++ = u3dLutOutputY;
-                    *pwDst3dLut++ = u3dLutOutputZ;
-                }
-            }
-        }
+    // Surface memory is write combined, generate in system memory and copy rows afterwards.
+    std::vector<uint8_t> lut((size_t)rowBytes * rowCount);
+    uint8_t             *lutData     = lut.data();
+    bool                 r10g10b10a2 = (osSurface->Format == Format_R10G10B10A2);
 
-        eStatus = MOS_STATUS_SUCCESS;
-    }
-    else if (pCRI3DLUTSurface->osSurface->Format == Format_R10G10B10A2)
-    {
-        bBytePerPixel = 4;
+    // Slices along blue axis are independent, generate one per job.
+    MOS_STATUS eStatus = MediaWorkerPool::GetInstance()->ParallelFor(lutSize, [&](uint32_t i) -> MOS_STATUS {
+        uint16_t u3dLutOutputX = 0, u3dLutOutputY = 0, u3dLutOutputZ = 0;
 
-        for (i = 0; i < params->Cri3DLUTSize; i++)
+        for (uint32_t j = 0; j < lutSize; j++)
         {
-            for (j = 0; j < params->Cri3DLUTSize; j++)
+            uint8_t *pRow = lutData + (i * lutSize + j) * rowBytes;
+            for (uint32_t k = 0; k < lutSize; k++)
             {
-                for (k = 0; k < params->Cri3DLUTSize; k++)
+                u3dLutOutputX = u3dLutOutputY = u3dLutOutputZ = 0;
+
+                VpHal_HdrColorTransfer3dLut(params,
+                    iIndex,
+                    (float)k / (float)(lutSize - 1),
+                    (float)j / (float)(lutSize - 1),
+                    (float)i / (float)(lutSize - 1),
+                    &u3dLutOutputX,
+                    &u3dLutOutputY,
+                    &u3dLutOutputZ);
+
+                if (r10g10b10a2)
                 {
-                    puiDst3dLut = (uint32_t *)(pByte +
-                                               i * params->Cri3DLUTSize * pCRI3DLUTSurface->osSurface->dwPitch +
-                                               j * pCRI3DLUTSurface->osSurface->dwPitch +
-                                               k * bBytePerPixel);
-
-                    u3dLutOutputX = u3dLutOutputY = u3dLutOutputZ = 0;
-
-                    VpHal_HdrColorTransfer3dLut(params,
-                        iIndex,
-                        (float)k / (float)(params->Cri3DLUTSize - 1),
-                        (float)j / (float)(params->Cri3DLUTSize - 1),
-                        (float)i / (float)(params->Cri3DLUTSize - 1),
-                        &u3dLutOutputX,
-                        &u3dLutOutputY,
-                        &u3dLutOutputZ);
-
+                    uint32_t *puiDst3dLut = (uint32_t *)(pRow + k * bBytePerPixel);
                     *puiDst3dLut = (uint32_t)u3dLutOutputX +
                                    ((uint32_t)u3dLutOutputY << 10) +
                                    ((uint32_t)u3dLutOutputZ << 20);
                 }
+                else
+                {
+                    uint16_t *pwDst3dLut = (uint16_t *)(pRow + k * bBytePerPixel);
+                    *pwDst3dLut++ = u3dLutOutputX;
+                    *pwDst3dLut++ = u3dLutOutputY;
+                    *pwDst3dLut++ = u3dLutOutputZ;
+                }
             }
         }
+        return MOS_STATUS_SUCCESS;
+    });
 
-        eStatus = MOS_STATUS_SUCCESS;
-    }
-    else
+    if (eStatus == MOS_STATUS_SUCCESS)
     {
-        VP_RENDER_ASSERTMESSAGE("Unexpected HDR 3DLUT format.");
-        eStatus = MOS_STATUS_INVALID_PARAMETER;
+        for (uint32_t row = 0; row < rowCount; row++)
+        {
+            MOS_SecureMemcpy(pByte + row * osSurface->dwPitch, rowBytes, lutData + row * rowBytes, rowBytes);
+        }
+        HdrCri3DLutCache::GetInstance().Insert(key, lut);
     }
 
-    VP_PUBLIC_CHK_STATUS_RETURN(m_allocator->UnLock(&pCRI3DLUTSurface->osSurface->OsResource));
+    VP_PUBLIC_CHK_STATUS_RETURN(m_allocator->UnLock(&osSurface->OsResource));
 
     return eStatus;
 }
@@ -1404,7 +1404,8 @@ MOS_STATUS VpVeboxCmdPacket::UpdateVeboxStates()
         return MOS_STATUS_SUCCESS;
     }
 
-    // Update DN State in CPU
+    // Update DN State in CPU. Statistics surface still holds the output of the frame
+    // which used it last time, i.e. statistics feedback lag frames before current one.
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
     LockFlags.ReadOnly = 1;
 
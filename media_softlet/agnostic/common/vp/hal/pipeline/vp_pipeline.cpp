@@ -652,6 +652,22 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     VpPacketReuseManager *packetReuseMgr  = singlePipeCtx->GetPacketReUseManager();
     uint32_t              frameCounter    = singlePipeCtx->GetFrameCounter();
     MOS_STATUS            eStatus         = MOS_STATUS_SUCCESS;
+    auto                 &stageTiming     = singlePipeCtx->GetStageTiming();
+    uint64_t              stageStart      = 0;
+
+    stageTiming = {};
+    MosUtilities::MosQueryPerformanceCounter(&stageStart);
+
+    auto stageEnd = [&](uint64_t &stageTicks) {
+        uint64_t now = 0;
+        MosUtilities::MosQueryPerformanceCounter(&now);
+        stageTicks = now - stageStart;
+        stageStart = now;
+    };
+
+    auto reportStageTiming = [&]() {
+        MOS_TraceEventExt(EVENT_VP_PIPE_STAGE_TIMING, EVENT_TYPE_INFO, &frameCounter, sizeof(frameCounter), &stageTiming, sizeof(stageTiming));
+    };
 
     auto retHandler = [&]() {
         m_pPacketPipeFactory->ReturnPacketPipe(pPacketPipe);
@@ -661,6 +677,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
         resourceManager->OnNewFrameProcessEnd();
         MT_LOG1(MT_VP_HAL_ONNEWFRAME_PROC_END, MT_NORMAL, MT_VP_HAL_ONNEWFRAME_COUNTER, frameCounter);
         singlePipeCtx->AddFrameCount();
+        reportStageTiming();
     };
 
     auto chkStatusHandler = [&](MOS_STATUS status) {
@@ -682,6 +699,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     // Notify resourceManager for start of new frame processing.
     MT_LOG1(MT_VP_HAL_ONNEWFRAME_PROC_START, MT_NORMAL, MT_VP_HAL_ONNEWFRAME_COUNTER, frameCounter);
     VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(resourceManager->OnNewFrameProcessStart(*pipe)));
+    stageEnd(stageTiming.frameStart);
 
     Policy *policy = featureManagerNext->GetPolicy();
     VP_PUBLIC_CHK_NULL_RETURN(chkNullHandler(policy));
@@ -689,6 +707,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     bool isPacketPipeReused = false;
     VP_PUBLIC_CHK_NULL_RETURN(m_pvpParams.renderParams);
     VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->PreparePacketPipeReuse(pipe, *policy, *resourceManager, isPacketPipeReused, m_pvpParams.renderParams->bOptimizeCpuTiming)));
+    stageEnd(stageTiming.packetReuse);
 
     if (isPacketPipeReused)
     {
@@ -704,6 +723,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
         singlePipeCtx->SetIsVeboxFeatureInuse(pipeReused->IsVeboxFeatureInuse());
         // MediaPipeline::m_statusReport is always nullptr in VP APO path right now.
         eStatus = pipeReused->Execute(MediaPipeline::m_statusReport, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox, gpuCtxOnHybridCmd, frameCounter);
+        stageEnd(stageTiming.execute);
         MT_LOG1(MT_VP_HAL_VEBOXNUM_CHECK, MT_NORMAL, MT_VP_HAL_VEBOX_NUMBER, m_numVebox)
         VP_PUBLIC_NORMALMESSAGE("Vebox Number for check %d", m_numVebox);
         if (MOS_SUCCEEDED(eStatus))
@@ -718,6 +738,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
         resourceManager->OnNewFrameProcessEnd();
         MT_LOG1(MT_VP_HAL_ONNEWFRAME_PROC_END, MT_NORMAL, MT_VP_HAL_ONNEWFRAME_COUNTER, frameCounter);
         singlePipeCtx->AddFrameCount();
+        reportStageTiming();
         return eStatus;
     }
     else
@@ -732,6 +753,8 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     m_vpInterface->GetSwFilterPipeFactory().Destory(pipe);
     VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(eStatus));
 
+    stageEnd(stageTiming.packetPipeInit);
+
     // Update output pipe mode.
     singlePipeCtx->SetOutputPipeMode(pPacketPipe->GetOutputPipeMode());
     singlePipeCtx->SetIsVeboxFeatureInuse(pPacketPipe->IsVeboxFeatureInuse());
@@ -739,6 +762,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
     // MediaPipeline::m_statusReport is always nullptr in VP APO path right now.
 
     eStatus = pPacketPipe->Execute(MediaPipeline::m_statusReport, m_scalability, m_mediaContext, MOS_VE_SUPPORTED(m_osInterface), m_numVebox, gpuCtxOnHybridCmd, frameCounter);
+    stageEnd(stageTiming.execute);
 
     MT_LOG1(MT_VP_HAL_VEBOXNUM_CHECK, MT_NORMAL, MT_VP_HAL_VEBOX_NUMBER, m_numVebox)
     VP_PUBLIC_NORMALMESSAGE("Vebox Number for check %d", m_numVebox);
@@ -787,6 +811,21 @@ finish:
     return eStatus;
 }
 
+MOS_STATUS VpPipeline::EndFrameArena()
+{
+    VP_FUNC_CALL();
+
+    VP_PUBLIC_CHK_NULL_RETURN(m_vpInterface);
+
+    VpFrameArena &arena = m_vpInterface->GetFrameArena();
+    VP_PUBLIC_CHK_STATUS_RETURN(arena.EndFrame());
+
+    VpFrameArena::Statistics stats = arena.GetStatistics();
+    MOS_TraceEventExt(EVENT_VP_FRAME_ARENA, EVENT_TYPE_INFO, &stats, sizeof(stats), nullptr, 0);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS VpPipeline::CreateSwFilterPipe(VP_PARAMS &params, std::vector<SwFilterPipe*> &swFilterPipe)
 {
     VP_FUNC_CALL();
@@ -1420,7 +1459,10 @@ MOS_STATUS VpPipeline::Execute()
 {
     VP_FUNC_CALL();
 
-    VP_PUBLIC_CHK_STATUS_RETURN(ExecuteVpPipeline())
+    MOS_STATUS status = ExecuteVpPipeline();
+    // End frame arena even if execution failed, objects still alive just defer the rewind.
+    VP_PUBLIC_CHK_STATUS_RETURN(EndFrameArena());
+    VP_PUBLIC_CHK_STATUS_RETURN(status);
     VP_PUBLIC_CHK_STATUS_RETURN(UserFeatureReport());
 
     bool veboxFeatureInuse = (m_vpPipeContexts.size() >= 1) && (m_vpPipeContexts[0]) && (m_vpPipeContexts[0]->IsVeboxInUse());
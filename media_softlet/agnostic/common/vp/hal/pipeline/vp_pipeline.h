@@ -303,6 +303,13 @@ protected:
     //!
     virtual MOS_STATUS UpdateExecuteStatus(uint32_t frameCn);
 
+    //!
+    //! \brief  End frame on frame arena of vp interface and report its allocations
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS EndFrameArena();
+
     //!
     //! \brief  Create SwFilterPipe
     //! \param  [in] params
@@ -508,6 +515,17 @@ using VP_SFC_PACKET_PARAMS = _VP_SFC_PACKET_PARAMS;
 class VpSinglePipeContext
 {
 public:
+    //!
+    //! \brief  CPU ticks spent in each stage of last frame on this pipe
+    //!
+    struct StageTiming
+    {
+        uint64_t frameStart     = 0;  //!< Resource assignment on new frame
+        uint64_t packetReuse    = 0;  //!< Packet pipe reuse check
+        uint64_t packetPipeInit = 0;  //!< HwFilterPipe build and packet creation
+        uint64_t execute        = 0;  //!< Packet state fill and command submission
+    };
+
     VpSinglePipeContext();
     virtual ~VpSinglePipeContext();
 
@@ -583,6 +601,11 @@ public:
         m_veboxFeatureInuse = isInuse;
     }
 
+    StageTiming &GetStageTiming()
+    {
+        return m_stageTiming;
+    }
+
 protected:
     VpPacketReuseManager *m_packetReuseMgr  = nullptr;
     VpResourceManager    *m_resourceManager = nullptr;
@@ -591,6 +614,7 @@ protected:
     bool                   m_packetReused      = false;  //!< true is packet reused.
     VPHAL_OUTPUT_PIPE_MODE m_vpOutputPipe      = VPHAL_OUTPUT_PIPE_MODE_INVALID;
     bool                   m_veboxFeatureInuse = false;
+    StageTiming            m_stageTiming       = {};
     MEDIA_CLASS_DEFINE_END(vp__VpSinglePipeContext)
 };
 
@@ -660,6 +684,11 @@ public:
         return m_hwFilterFactory;
     }
 
+    VpFrameArena& GetFrameArena()
+    {
+        return m_frameArena;
+    }
+
     VpAllocator& GetAllocator()
     {
         return m_allocator;
@@ -693,6 +722,8 @@ public:
     }
 
 private:
+    // Declared before factories, which release their objects into it on destruction.
+    VpFrameArena        m_frameArena;
     SwFilterPipeFactory m_swFilterPipeFactory;
     HwFilterPipeFactory m_hwFilterPipeFactory;
     HwFilterFactory     m_hwFilterFactory;
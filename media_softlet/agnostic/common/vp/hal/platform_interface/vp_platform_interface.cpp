@@ -28,6 +28,7 @@
 #include "vp_visa.h"
 #include "vp_user_setting.h"
 #include "vp_feature_manager_softlet.h"
+#include "media_kernel_blob.h"
 
 using namespace vp;
 extern const Kdll_RuleEntry g_KdllRuleTable_Next[];
@@ -358,11 +359,19 @@ void VpPlatformInterface::InitVpNativeAdvKernels(
     VP_FUNC_CALL();
 
     VpRenderKernel vpKernel;
+    const uint32_t *kernelBin     = nullptr;
+    uint32_t        kernelBinSize = 0;
 
-    vpKernel.SetKernelBinPointer((void *)kernelBinaryEntry.kernelBin);
+    if (MediaKernelBlob::Load(kernelBinaryEntry.kernelBin, kernelBinaryEntry.kernelBinSize, kernelBin, kernelBinSize) != MOS_STATUS_SUCCESS)
+    {
+        VP_PUBLIC_ASSERTMESSAGE("Failed to load kernel binary of %s.", kernelName.c_str());
+        return;
+    }
+
+    vpKernel.SetKernelBinPointer((void *)kernelBin);
     vpKernel.SetKernelName(kernelName);
     vpKernel.SetKernelBinOffset(0x0);
-    vpKernel.SetKernelBinSize(kernelBinaryEntry.kernelBinSize);
+    vpKernel.SetKernelBinSize(kernelBinSize);
     m_kernelPool.emplace(vpKernel.GetKernelName(), vpKernel);
 
     return;
@@ -382,6 +391,8 @@ MOS_STATUS VpPlatformInterface::InitVpCmKernels(
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
+    VP_PUBLIC_CHK_STATUS_RETURN(MediaKernelBlob::Load(cisaCode, cisaCodeSize, cisaCode, cisaCodeSize));
+
     uint8_t *pBuf             = (uint8_t *)cisaCode;
     uint32_t bytePos          = 0;
     uint32_t cisaMagicNumber  = 0;
@@ -577,11 +588,18 @@ void VpPlatformInterface::SetVpFCKernelBinary(
                 uint32_t         fcPatchKernelBinSize)
 {
     VP_FUNC_CALL();
-    
-    m_vpKernelBinary.kernelBin            = kernelBin;
-    m_vpKernelBinary.kernelBinSize        = kernelBinSize;
-    m_vpKernelBinary.fcPatchKernelBin     = fcPatchKernelBin;
-    m_vpKernelBinary.fcPatchKernelBinSize = fcPatchKernelBinSize;
+
+    // Kernel arrays may be compressed blobs. Expand them here so that every
+    // consumer of m_vpKernelBinary, including platform overrides, gets the
+    // raw kernel. A failure leaves the binary null, which is caught in
+    // InitVpRenderHwCaps.
+    if (MediaKernelBlob::Load(kernelBin, kernelBinSize, m_vpKernelBinary.kernelBin, m_vpKernelBinary.kernelBinSize) != MOS_STATUS_SUCCESS ||
+        MediaKernelBlob::Load(fcPatchKernelBin, fcPatchKernelBinSize, m_vpKernelBinary.fcPatchKernelBin, m_vpKernelBinary.fcPatchKernelBinSize) != MOS_STATUS_SUCCESS)
+    {
+        VP_PUBLIC_ASSERTMESSAGE("Failed to load VP FC kernel binary.");
+        m_vpKernelBinary.kernelBin        = nullptr;
+        m_vpKernelBinary.fcPatchKernelBin = nullptr;
+    }
 }
 
 MOS_STATUS VpPlatformInterface::InitializeDelayedKernels(DelayLoadedKernelType type)
@@ -146,6 +146,13 @@ MOS_STATUS VpUserSetting::InitVpUserSetting(MediaUserSettingSharedPtr userSettin
             1,
             true);
 
+        DeclareUserSettingKey(  // Frames between vebox statistics written by GPU and read by CPU for HVS denoise. 1: previous frame.
+            userSettingPtr,
+            __VPHAL_VEBOX_STATISTICS_FEEDBACK_LAG,
+            MediaUserSetting::Group::Sequence,
+            1,
+            true);
+
         DeclareUserSettingKey(  // Eanble Apogeios path in VP PipeLine. 1: enabled, 0: disabled.
             userSettingPtr,
             __MEDIA_USER_FEATURE_VALUE_VPP_APOGEIOS_ENABLE,
@@ -292,6 +292,20 @@ VpUserFeatureControl::VpUserFeatureControl(MOS_INTERFACE &osInterface, VpPlatfor
         m_ctrlValDefault.splitFramePortions = splitFramePortions;
     }
 
+    uint32_t veboxStatisticsFeedbackLag = 1;
+    status                              = ReadUserSetting(
+        m_userSettingPtr,
+        veboxStatisticsFeedbackLag,
+        __VPHAL_VEBOX_STATISTICS_FEEDBACK_LAG,
+        MediaUserSetting::Group::Sequence,
+        veboxStatisticsFeedbackLag,
+        true);
+    if (MOS_SUCCEEDED(status))
+    {
+        m_ctrlValDefault.veboxStatisticsFeedbackLag = veboxStatisticsFeedbackLag;
+    }
+    VP_PUBLIC_NORMALMESSAGE("veboxStatisticsFeedbackLag %d", m_ctrlValDefault.veboxStatisticsFeedbackLag);
+
 #if (_DEBUG || _RELEASE_INTERNAL)
     std::string lut3DFilePath = "";
     status = ReadUserSetting(
@@ -76,6 +76,7 @@ public:
         bool               disableAutoMode    = false;
         bool               clearVideoViewMode = false;
         uint32_t           splitFramePortions = 1;
+        uint32_t           veboxStatisticsFeedbackLag = 1;             //!< Frames between vebox statistics output and CPU readback
         bool               decompForInterlacedSurfWaEnabled = false;
         bool               enableSFCLinearOutputByTileConvert = false;
         bool               fallbackScalingToRender8K          = false;
@@ -239,6 +240,11 @@ public:
         return m_ctrlVal.splitFramePortions;
     }
 
+    uint32_t GetVeboxStatisticsFeedbackLag()
+    {
+        return m_ctrlVal.veboxStatisticsFeedbackLag;
+    }
+
     uint64_t GetHybridMgrSubmitMode()
     {
         return m_ctrlVal.hybridMgrSubmitMode;
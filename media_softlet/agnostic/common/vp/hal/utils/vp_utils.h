@@ -314,6 +314,7 @@ protected:
 #define __VPHAL_HDR_GPU_GENERTATE_3DLUT                                 "HDR GPU generate 3DLUT"
 #define __VPHAL_HDR_DISABLE_AUTO_MODE                                   "Disable HDR Auto Mode"
 #define __VPHAL_HDR_SPLIT_FRAME_PORTIONS                                "VPHAL HDR Split Frame Portions"
+#define __VPHAL_VEBOX_STATISTICS_FEEDBACK_LAG                           "VP Vebox Statistics Feedback Lag"
 #define __MEDIA_USER_FEATURE_VALUE_VPP_APOGEIOS_ENABLE                  "VP Apogeios Enabled"
 #define __VPHAL_PRIMARY_MMC_COMPRESSMODE                                "VP Primary Surface Compress Mode"
 #define __VPHAL_RT_MMC_COMPRESSMODE                                     "VP RT Compress Mode"
@@ -34,6 +34,7 @@
 #include "media_interfaces_codechal_next.h"
 #include "ddi_decode_trace_specific.h"
 #include "media_libva_caps_next.h"
+#include "media_user_setting.h"
 
 namespace decode
 {
@@ -302,11 +303,45 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
     /* As it is checked in previous caller, it is skipped. */
     bufMgr = &(m_decodeCtx->BufMgr);
 
+    // Whole frame is in wrapped application memory, decode from it directly.
+    if (m_userptrBitstream != nullptr)
+    {
+        MediaLibvaCommonNext::MediaBufferToMosResource(m_userptrBitstream, &bufMgr->resBitstreamBuffer);
+        m_userptrBitstream = nullptr;
+        m_userptrData      = nullptr;
+        m_userptrSize      = 0;
+        return VA_STATUS_SUCCESS;
+    }
+
     if (bufMgr && (bufMgr->bIsSliceOverSize == false))
     {
         return VA_STATUS_SUCCESS;
     }
 
+    FreeRetiredBitstreams(false);
+
+    // Slices before the first overflowed one are contiguous at the head of bitstream buffer.
+    uint32_t headSize  = 0;
+    uint32_t frameSize = m_decodeCtx->DecodeParams.m_dataSize;
+    uint32_t slcInd    = 0;
+    for (slcInd = 0; slcInd < bufMgr->dwNumSliceData; slcInd++)
+    {
+        if (bufMgr->pSliceData[slcInd].bIsUseExtBuf == false)
+        {
+            headSize = bufMgr->pSliceData[slcInd].uiOffset + bufMgr->pSliceData[slcInd].uiLength;
+        }
+    }
+    if (bufMgr->dwNumSliceData > 0)
+    {
+        uint32_t lastSlice = bufMgr->dwNumSliceData - 1;
+        frameSize = MOS_MAX(frameSize, bufMgr->pSliceData[lastSlice].uiOffset + bufMgr->pSliceData[lastSlice].uiLength);
+    }
+
+    // Grow with some headroom, so following frames of similar size are
+    // written to bitstream buffer directly and need no combine.
+    uint64_t capacity   = MOS_ALIGN_CEIL((uint64_t)frameSize + frameSize / 4, MOS_PAGE_SIZE);
+    m_bitstreamCapacity = (uint32_t)MOS_MIN(capacity, (uint64_t)INT32_MAX);
+
     PDDI_MEDIA_BUFFER newBitstreamBuffer;
     // allocate a new bit stream buffer
     newBitstreamBuffer = (DDI_MEDIA_BUFFER *)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_BUFFER));
@@ -316,7 +351,7 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
         return VA_STATUS_ERROR_DECODING_ERROR;
     }
 
-    newBitstreamBuffer->iSize     = m_decodeCtx->DecodeParams.m_dataSize;
+    newBitstreamBuffer->iSize     = MOS_MAX(m_bitstreamCapacity, frameSize);
     newBitstreamBuffer->uiType    = VASliceDataBufferType;
     newBitstreamBuffer->format    = Media_Format_Buffer;
     newBitstreamBuffer->uiOffset  = 0;
@@ -343,8 +378,18 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
 
-    uint32_t slcInd = 0;
-    // copy data to new bit stream
+    // Head is moved by GPU where possible, CPU only writes the remaining
+    // partial page and the overflowed slices which are in system memory.
+    uint32_t gpuCopied = CopyBitstreamHeadByGpu(
+        bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex], newBitstreamBuffer, headSize);
+    if (headSize > gpuCopied)
+    {
+        MOS_StreamingMemcpy(newBitStreamBase + gpuCopied,
+            headSize - gpuCopied,
+            bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex] + gpuCopied,
+            headSize - gpuCopied);
+    }
+
     for (slcInd = 0; slcInd < bufMgr->dwNumSliceData; slcInd++)
     {
         if (bufMgr->pSliceData[slcInd].bIsUseExtBuf == true)
@@ -355,19 +400,12 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
                     bufMgr->pSliceData[slcInd].uiLength,
                     bufMgr->pSliceData[slcInd].pSliceBuf,
                     bufMgr->pSliceData[slcInd].uiLength);
-                MOS_FreeMemory(bufMgr->pSliceData[slcInd].pSliceBuf);
                 bufMgr->pSliceData[slcInd].pSliceBuf    = nullptr;
                 bufMgr->pSliceData[slcInd].bIsUseExtBuf = false;
             }
         }
-        else
-        {
-            MOS_SecureMemcpy(newBitStreamBase + bufMgr->pSliceData[slcInd].uiOffset,
-                bufMgr->pSliceData[slcInd].uiLength,
-                bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex] + bufMgr->pSliceData[slcInd].uiOffset,
-                bufMgr->pSliceData[slcInd].uiLength);
-        }
     }
+    ResetSliceDataChunks();
 
     // free original buffers
     if (bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex])
@@ -378,19 +416,299 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
 
     if (bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex])
     {
-        MediaLibvaUtilNext::FreeBuffer(bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]);
-        MOS_FreeMemory(bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]);
+        if (gpuCopied > 0)
+        {
+            // GPU copy is only queued, keep the source until it is done.
+            m_retiredBitstreams.push_back(bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]);
+        }
+        else
+        {
+            MediaLibvaUtilNext::FreeBuffer(bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]);
+            MOS_FreeMemory(bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]);
+        }
         bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex] = nullptr;
     }
 
     // set new bitstream buffer
     bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex] = newBitstreamBuffer;
     bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex]       = newBitStreamBase;
+    bufMgr->bIsSliceOverSize                               = false;
     MediaLibvaCommonNext::MediaBufferToMosResource(m_decodeCtx->BufMgr.pBitStreamBuffObject[bufMgr->dwBitstreamIndex], &m_decodeCtx->BufMgr.resBitstreamBuffer);
 
     return VA_STATUS_SUCCESS;
 }
 
+uint32_t DdiDecodeBase::CopyBitstreamHeadByGpu(
+    DDI_MEDIA_BUFFER *srcBuffer,
+    DDI_MEDIA_BUFFER *dstBuffer,
+    uint32_t          size)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    const uint32_t pitch  = MOS_PAGE_SIZE;
+    uint32_t       height = size / pitch;
+    if (height == 0 || srcBuffer == nullptr || dstBuffer == nullptr || m_decodeCtx->pCodecHal == nullptr)
+    {
+        return 0;
+    }
+
+    PMOS_INTERFACE osInterface = m_decodeCtx->pCodecHal->GetOsInterface();
+    if (osInterface == nullptr || osInterface->pfnMonoSurfaceCopy == nullptr)
+    {
+        return 0;
+    }
+
+    MOS_RESOURCE srcResource = {};
+    MOS_RESOURCE dstResource = {};
+    MediaLibvaCommonNext::MediaBufferToMosResource(srcBuffer, &srcResource);
+    MediaLibvaCommonNext::MediaBufferToMosResource(dstBuffer, &dstResource);
+    if (srcResource.pGmmResInfo == nullptr || dstResource.pGmmResInfo == nullptr)
+    {
+        return 0;
+    }
+
+    // Media copy may override layout of the buffers to a 2D view, keep the
+    // new bitstream buffer described as it is allocated.
+    GMM_GFX_SIZE_T dstPitch = dstResource.pGmmResInfo->GetRenderPitch();
+
+    MOS_STATUS status = osInterface->pfnMonoSurfaceCopy(
+        osInterface, &srcResource, &dstResource, pitch, height, 0, 0, false);
+
+    dstResource.pGmmResInfo->OverridePitch(dstPitch);
+
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        DDI_CODEC_NORMALMESSAGE("GPU bitstream copy failed, fall back to CPU.");
+        return 0;
+    }
+
+    return pitch * height;
+}
+
+void DdiDecodeBase::FreeRetiredBitstreams(bool wait)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    auto it = m_retiredBitstreams.begin();
+    while (it != m_retiredBitstreams.end())
+    {
+        DDI_MEDIA_BUFFER *buffer = *it;
+        if (buffer->bo != nullptr && mos_bo_busy(buffer->bo))
+        {
+            if (!wait)
+            {
+                it++;
+                continue;
+            }
+            mos_bo_wait_rendering(buffer->bo);
+        }
+        MediaLibvaUtilNext::FreeBuffer(buffer);
+        MOS_FreeMemory(buffer);
+        it = m_retiredBitstreams.erase(it);
+    }
+}
+
+uint8_t *DdiDecodeBase::AllocSliceDataChunk(uint32_t size)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    const uint32_t minChunkSize   = 0x100000;
+    const uint32_t maxChunkSize   = 0x1000000;
+    const uint32_t sliceAlignment = 64;
+
+    uint32_t alignedSize = MOS_ALIGN_CEIL(size, sliceAlignment);
+    for (auto &chunk : m_sliceDataChunks)
+    {
+        if (chunk.size - chunk.used >= alignedSize)
+        {
+            uint8_t *data = chunk.base + chunk.used;
+            chunk.used += alignedSize;
+            chunk.idleFrames = 0;
+            MOS_ZeroMemory(data, size);
+            return data;
+        }
+    }
+
+    // Chunks are never reallocated, slices handed out earlier in this frame stay valid.
+    // Growth doubles up to maxChunkSize, a larger slice gets a chunk of its own size.
+    SliceDataChunk chunk;
+    chunk.size = MOS_MAX(alignedSize, minChunkSize);
+    if (!m_sliceDataChunks.empty())
+    {
+        chunk.size = MOS_MAX(chunk.size, MOS_MIN(m_sliceDataChunks.back().size * 2, maxChunkSize));
+    }
+    chunk.base = (uint8_t *)MOS_AllocAndZeroMemory(chunk.size);
+    if (chunk.base == nullptr)
+    {
+        return nullptr;
+    }
+    chunk.used = alignedSize;
+    m_sliceDataChunks.push_back(chunk);
+
+    return chunk.base;
+}
+
+void DdiDecodeBase::ResetSliceDataChunks()
+{
+    for (auto &chunk : m_sliceDataChunks)
+    {
+        chunk.used = 0;
+    }
+}
+
+void DdiDecodeBase::TrimSliceDataChunks()
+{
+    const uint32_t maxIdleFrames = 16;
+
+    auto it = m_sliceDataChunks.begin();
+    while (it != m_sliceDataChunks.end())
+    {
+        if (++it->idleFrames > maxIdleFrames)
+        {
+            MOS_FreeMemory(it->base);
+            it = m_sliceDataChunks.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void DdiDecodeBase::FreeSliceDataChunks()
+{
+    for (auto &chunk : m_sliceDataChunks)
+    {
+        MOS_FreeMemory(chunk.base);
+    }
+    m_sliceDataChunks.clear();
+}
+
+bool DdiDecodeBase::UseUserptrSliceData(void *data, uint32_t size)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    // Small frames are cheaper to copy than to wrap.
+    const uint32_t minUserptrSize  = 0x10000;
+    const uint32_t maxUserptrCount = 32;
+
+    DDI_CODEC_COM_BUFFER_MGR *bufMgr = &(m_decodeCtx->BufMgr);
+    if (!m_userptrSliceData ||
+        data == nullptr ||
+        size < minUserptrSize ||
+        size > INT32_MAX - MOS_PAGE_SIZE ||
+        ((uintptr_t)data & (MOS_PAGE_SIZE - 1)) != 0 ||
+        bufMgr->dwNumSliceData != 1 ||
+        m_decodeCtx->wMode == CODECHAL_DECODE_MODE_JPEG ||
+        m_decodeCtx->wMode == CODECHAL_DECODE_MODE_VVCVLD ||
+        (m_ddiDecodeAttr && m_ddiDecodeAttr->componentData.data.encryptType))
+    {
+        return false;
+    }
+
+    uint32_t          alignedSize = MOS_ALIGN_CEIL(size, MOS_PAGE_SIZE);
+    DDI_MEDIA_BUFFER *buffer      = nullptr;
+    auto              lru         = m_userptrCache.end();
+    for (auto it = m_userptrCache.begin(); it != m_userptrCache.end(); it++)
+    {
+        if (it->addr == (uintptr_t)data)
+        {
+            if (it->buffer->iSize >= (int32_t)alignedSize)
+            {
+                buffer = it->buffer;
+                it->lastUse = ++m_userptrUseCount;
+                break;
+            }
+            // Same address with larger data, wrap again
+            lru = it;
+            break;
+        }
+        if (lru == m_userptrCache.end() || it->lastUse < lru->lastUse)
+        {
+            lru = it;
+        }
+    }
+
+    if (buffer == nullptr)
+    {
+        if (lru != m_userptrCache.end() &&
+            (lru->addr == (uintptr_t)data || m_userptrCache.size() >= maxUserptrCount))
+        {
+            MediaLibvaUtilNext::FreeBuffer(lru->buffer);
+            MOS_FreeMemory(lru->buffer);
+            m_userptrCache.erase(lru);
+        }
+
+        buffer = (DDI_MEDIA_BUFFER *)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_BUFFER));
+        if (buffer == nullptr)
+        {
+            return false;
+        }
+        buffer->iSize     = alignedSize;
+        buffer->uiType    = VASliceDataBufferType;
+        buffer->pMediaCtx = m_decodeCtx->pMediaCtx;
+        if (MediaLibvaUtilNext::CreateUserptrBuffer(buffer, data, m_decodeCtx->pMediaCtx->pDrmBufMgr) != VA_STATUS_SUCCESS)
+        {
+            MOS_FreeMemory(buffer);
+            if (m_userptrCache.empty())
+            {
+                // Never wrapped successfully, kernel rejects userptr, stop paying for the attempt.
+                DDI_CODEC_NORMALMESSAGE("Userptr wrap failed, slice data is copied from now on.");
+                m_userptrSliceData = false;
+            }
+            return false;
+        }
+
+        UserptrRange range;
+        range.addr    = (uintptr_t)data;
+        range.buffer  = buffer;
+        range.lastUse = ++m_userptrUseCount;
+        m_userptrCache.push_back(range);
+    }
+
+    m_userptrBitstream = buffer;
+    m_userptrData      = (uint8_t *)data;
+    m_userptrSize      = size;
+
+    return true;
+}
+
+void DdiDecodeBase::FlushUserptrSliceData(DDI_CODEC_COM_BUFFER_MGR *bufMgr)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    if (m_userptrBitstream == nullptr)
+    {
+        return;
+    }
+
+    // Bitstream buffer is sized for the first slice, which is wrapped so far.
+    if (bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex] != nullptr)
+    {
+        MOS_SecureMemcpy(bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex],
+            bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]->iSize,
+            m_userptrData,
+            m_userptrSize);
+    }
+
+    m_userptrBitstream = nullptr;
+    m_userptrData      = nullptr;
+    m_userptrSize      = 0;
+}
+
+void DdiDecodeBase::FreeUserptrBuffers()
+{
+    for (auto &range : m_userptrCache)
+    {
+        MediaLibvaUtilNext::FreeBuffer(range.buffer);
+        MOS_FreeMemory(range.buffer);
+    }
+    m_userptrCache.clear();
+    m_userptrBitstream = nullptr;
+    m_userptrData      = nullptr;
+    m_userptrSize      = 0;
+}
+
 VAStatus DdiDecodeBase::CheckDecodeResolution(
     ConfigLinux       *configItem,
     uint32_t          width,
@@ -507,6 +825,8 @@ void DdiDecodeBase::DestroyContext(VADriverContextP ctx)
     }
 #endif
 
+    FreeUserptrBuffers();
+
     return;
 }
 
@@ -571,13 +891,14 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
 
     if (index >= 1)
     {
+        FlushUserptrSliceData(bufMgr);
         buf->uiOffset = bufMgr->pSliceData[index-1].uiOffset + bufMgr->pSliceData[index-1].uiLength;
         if ((buf->uiOffset + buf->iSize) > bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]->iSize)
         {
-            sliceBuf = (uint8_t*)MOS_AllocAndZeroMemory(buf->iSize);
+            sliceBuf = AllocSliceDataChunk(buf->iSize);
             if (sliceBuf == nullptr)
             {
-                DDI_CODEC_ASSERTMESSAGE("DDI:AllocAndZeroMem return failure.")
+                DDI_CODEC_ASSERTMESSAGE("DDI:AllocSliceDataChunk return failure.")
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
             bufMgr->bIsSliceOverSize = true;
@@ -590,6 +911,12 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
     else
     {
         bufMgr->bIsSliceOverSize = false;
+        // Wrap left by a frame which failed before combine must not be used by this frame.
+        m_userptrBitstream = nullptr;
+        m_userptrData      = nullptr;
+        m_userptrSize      = 0;
+        TrimSliceDataChunks();
+        ResetSliceDataChunks();
         for (i = 0; i < DDI_CODEC_MAX_BITSTREAM_BUFFER; i++)
         {
             if (bufMgr->pBitStreamBuffObject[i]->bo != nullptr)
@@ -624,15 +951,18 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         bsBufObj->pMediaCtx = m_decodeCtx->pMediaCtx;
         bsBufBaseAddr       = bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex];
 
+        // Size for the whole frame learnt from previous frames, so rest of
+        // slices are appended in place instead of combined at end picture.
+        int32_t requiredSize = MOS_MAX(buf->iSize, (int32_t)m_bitstreamCapacity);
         if (bsBufBaseAddr == nullptr)
         {
             createBsBuffer = true;
-            if (buf->iSize > bsBufObj->iSize)
+            if (requiredSize > bsBufObj->iSize)
             {
-                bsBufObj->iSize = buf->iSize;
+                bsBufObj->iSize = requiredSize;
             }
         }
-        else if (buf->iSize > bsBufObj->iSize)
+        else if (requiredSize > bsBufObj->iSize)
         {
            // free bo
             MediaLibvaUtilNext::UnlockBuffer(bsBufObj);
@@ -640,7 +970,7 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
             bsBufBaseAddr = nullptr;
 
             createBsBuffer  = true;
-            bsBufObj->iSize = buf->iSize;
+            bsBufObj->iSize = requiredSize;
         }
 
         if (createBsBuffer)
@@ -1157,6 +1487,11 @@ VAStatus DdiDecodeBase::CreateBuffer(
         return va;
     }
 
+    if (type == VASliceDataBufferType && UseUserptrSliceData(data, size * numElements))
+    {
+        return va;
+    }
+
     if (true == buf->bCFlushReq)
     {
         mos_bo_wait_rendering(buf->bo);
@@ -1262,6 +1597,15 @@ VAStatus DdiDecodeBase::CreateCodecHal(
 
     m_decodeCtx->pCpDdiInterfaceNext->CreateCencDecode(codecHal->GetDebugInterface(), mosCtx, m_codechalSettings);
 
+    uint32_t userptrSliceData = 0;
+    ReadUserSetting(
+        mediaCtx->m_userSettingPtr,
+        userptrSliceData,
+        "Decode Userptr Slice Data",
+        MediaUserSetting::Group::Device);
+    // Xe bufmgr has no userptr support, check once instead of failing a wrap per frame.
+    m_userptrSliceData = userptrSliceData && mos_bufmgr_has_userptr(mediaCtx->pDrmBufMgr);
+
     return vaStatus;
 }
 
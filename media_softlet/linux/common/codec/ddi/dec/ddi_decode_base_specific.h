@@ -28,6 +28,7 @@
 #define _DDI_DECODE_BASE_SPECIFIC_H_
 
 #include <stdint.h>
+#include <vector>
 #include <va/va.h>
 #include "ddi_codec_base_specific.h"
 #include "decode_pipeline_adapter.h"
@@ -62,6 +63,8 @@ public:
         MOS_FreeMemory(m_procBuf);
         m_procBuf = nullptr;
 #endif
+        FreeSliceDataChunks();
+        FreeRetiredBitstreams(true);
     }
 
     //! \brief    the type conversion to get the DDI_DECODE_CONTEXT
@@ -455,6 +458,72 @@ protected:
     //!           VA_STATUS_SUCCESS if success, else fail reason
     VAStatus InitDummyReference(DecodePipelineAdapter& decoder);
 
+    //! \brief    Get system memory for slice data which does not fit into bitstream buffer
+    //! \details  Memory is carved from chunks kept across frames, so slices
+    //!           never move once application gets the address.
+    //!
+    //! \param    [in] size
+    //!           Size of slice data in bytes
+    //!
+    //! \return   uint8_t *
+    //!           Zeroed memory for slice data, nullptr if fail
+    uint8_t *AllocSliceDataChunk(uint32_t size);
+
+    //! \brief    Reset usage of slice data chunks for a new frame
+    void ResetSliceDataChunks();
+
+    //! \brief    Free slice data chunks not used for a number of frames
+    //! \details  Called at the first slice of each frame. Chunks are only
+    //!           needed until bitstream buffer grows to the frame size, so
+    //!           they go idle soon after a resolution or bitrate change.
+    void TrimSliceDataChunks();
+
+    //! \brief    Free all slice data chunks
+    void FreeSliceDataChunks();
+
+    //! \brief    Copy head of bitstream from old to new bitstream buffer by GPU
+    //! \details  Only whole pages are copied by GPU, caller copies the rest.
+    //!
+    //! \param    [in] srcBuffer
+    //!           Old bitstream buffer
+    //! \param    [in] dstBuffer
+    //!           New bitstream buffer
+    //! \param    [in] size
+    //!           Bytes to copy from offset 0
+    //!
+    //! \return   uint32_t
+    //!           Bytes copied by GPU, 0 if GPU copy is not available
+    uint32_t CopyBitstreamHeadByGpu(
+        DDI_MEDIA_BUFFER *srcBuffer,
+        DDI_MEDIA_BUFFER *dstBuffer,
+        uint32_t          size);
+
+    //! \brief    Free old bitstream buffers which GPU copy no longer reads
+    //!
+    //! \param    [in] wait
+    //!           Wait for GPU to finish with busy buffers, else keep them for next call
+    void FreeRetiredBitstreams(bool wait);
+
+    //! \brief    Use application memory of first slice data buffer as bitstream in place
+    //! \details  Only for frames whose whole bitstream is in one page aligned
+    //!           buffer, application must keep the memory unchanged until
+    //!           decode of the frame completes.
+    //!
+    //! \param    [in] data
+    //!           Slice data passed to vaCreateBuffer
+    //! \param    [in] size
+    //!           Slice data size in bytes
+    //!
+    //! \return   bool
+    //!           true if slice data is wrapped, false if caller should copy it
+    bool UseUserptrSliceData(void *data, uint32_t size);
+
+    //! \brief    Copy wrapped slice data into bitstream buffer when more slices come
+    void FlushUserptrSliceData(DDI_CODEC_COM_BUFFER_MGR *bufMgr);
+
+    //! \brief    Free all cached userptr bitstream buffers
+    void FreeUserptrBuffers();
+
     //! \brief  the type of decode base class
     MOS_SURFACE           m_destSurface;          //!<Destination Surface structure
     uint32_t              m_groupIndex;           //!<global Group
@@ -470,6 +539,30 @@ protected:
     static const uint32_t m_decDefaultMaxWidth = 4096;
     static const uint32_t m_decDefaultMaxHeight = 4096;
 
+    struct SliceDataChunk
+    {
+        uint8_t *base       = nullptr;
+        uint32_t size       = 0;
+        uint32_t used       = 0;
+        uint32_t idleFrames = 0;   //!< Frames since slice data was last carved from the chunk
+    };
+    std::vector<SliceDataChunk>     m_sliceDataChunks;         //!< Slice data of current frame which overflows bitstream buffer
+    uint32_t                        m_bitstreamCapacity = 0;   //!< Minimum bitstream buffer size, grows with the largest frame seen
+    std::vector<DDI_MEDIA_BUFFER *> m_retiredBitstreams;       //!< Replaced bitstream buffers which may still be read by GPU copy
+
+    struct UserptrRange
+    {
+        uintptr_t         addr    = 0;
+        DDI_MEDIA_BUFFER *buffer  = nullptr;
+        uint64_t          lastUse = 0;
+    };
+    bool                      m_userptrSliceData = false;       //!< Wrap application slice data instead of copy
+    std::vector<UserptrRange> m_userptrCache;                   //!< Wrapped application ranges, LRU evicted
+    uint64_t                  m_userptrUseCount  = 0;
+    DDI_MEDIA_BUFFER         *m_userptrBitstream = nullptr;     //!< Wrapped bitstream of current frame
+    uint8_t                  *m_userptrData      = nullptr;
+    uint32_t                  m_userptrSize      = 0;
+
 #ifdef _DECODE_PROCESSING_SUPPORTED
     bool                           m_requireInputRegion = false;
     VAProcPipelineParameterBuffer *m_procBuf = nullptr; //!< Process parameters for vp sfc input
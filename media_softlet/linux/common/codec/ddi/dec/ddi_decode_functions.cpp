@@ -27,6 +27,9 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 #include <linux/fb.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 #include "ddi_decode_functions.h"
 #include "media_libva_util_next.h"
@@ -1051,42 +1054,73 @@ VAStatus DdiDecodeFunctions::StatusReport(
         {
             DDI_CODEC_CHK_CONDITION((uNumCompletedReport == 0), "No report available at all", VA_STATUS_ERROR_OPERATION_FAILED);
 
-            for (uint32_t i = 0; i < uNumCompletedReport; i++)
-            {
-                DecodeStatusReportData tempNewReport;
-                MOS_ZeroMemory(&tempNewReport, sizeof(CodechalDecodeStatusReport));
-                MOS_STATUS eStatus = decoder->GetStatusReport(&tempNewReport, 1);
-                DDI_CODEC_CHK_CONDITION(MOS_STATUS_SUCCESS != eStatus, "Get status report fail", VA_STATUS_ERROR_OPERATION_FAILED);
+            // Consume completed reports in batches and update their surfaces in
+            // one walk of the surface heap per batch, instead of one walk per report.
+            const uint32_t                               maxBatchSize = 32;
+            std::vector<DecodeStatusReportData>          reports(MOS_MIN(uNumCompletedReport, maxBatchSize));
+            std::unordered_map<MOS_LINUX_BO *, uint32_t> boToReport;
+            bool                                         reportValid = true;
 
-                MOS_LINUX_BO *bo = tempNewReport.currDecodedPicRes.bo;
+            for (uint32_t remaining = uNumCompletedReport; remaining > 0;)
+            {
+                std::fill(reports.begin(), reports.end(), DecodeStatusReportData());
 
-                if ((tempNewReport.codecStatus == CODECHAL_STATUS_SUCCESSFUL)   ||
-                    (tempNewReport.codecStatus == CODECHAL_STATUS_ERROR)        ||
-                    (tempNewReport.codecStatus == CODECHAL_STATUS_RESET)        ||
-                    (tempNewReport.codecStatus == CODECHAL_STATUS_INCOMPLETE))
+                uint32_t   numReported = 0;
+                MOS_STATUS eStatus     = decoder->GetCompletedStatusReports(
+                    reports.data(), sizeof(DecodeStatusReportData), MOS_MIN(remaining, maxBatchSize), numReported);
+                DDI_CODEC_CHK_CONDITION(MOS_STATUS_SUCCESS != eStatus, "Get status report fail", VA_STATUS_ERROR_OPERATION_FAILED);
+                if (numReported == 0)
                 {
-                    PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
+                    break;
+                }
+                remaining -= MOS_MIN(remaining, numReported);
 
-                    uint32_t j = 0;
-                    for (j = 0; j < mediaCtx->pSurfaceHeap->uiAllocatedHeapElements && mediaSurfaceHeapElmt != nullptr; j++, mediaSurfaceHeapElmt++)
+                boToReport.clear();
+                for (uint32_t i = 0; i < numReported; i++)
+                {
+                    if ((reports[i].codecStatus == CODECHAL_STATUS_SUCCESSFUL)   ||
+                        (reports[i].codecStatus == CODECHAL_STATUS_ERROR)        ||
+                        (reports[i].codecStatus == CODECHAL_STATUS_RESET)        ||
+                        (reports[i].codecStatus == CODECHAL_STATUS_INCOMPLETE))
                     {
-                        if (mediaSurfaceHeapElmt->pSurface != nullptr && bo == mediaSurfaceHeapElmt->pSurface->bo)
-                        {
-                            mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.status = (uint32_t)tempNewReport.codecStatus;
-                            mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.errMbNum = (uint32_t)tempNewReport.numMbsAffected;
-                            mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.crcValue = (uint32_t)tempNewReport.frameCrc;
-                            mediaSurfaceHeapElmt->pSurface->curStatusReportQueryState = DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED;
-                            break;
-                        }
+                        // Later report of the same surface wins.
+                        boToReport[reports[i].currDecodedPicRes.bo] = i;
+                    }
+                    else
+                    {
+                        reportValid = false;
                     }
-
                 }
-                else
+
+                PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
+                uint32_t                        numUpdated           = 0;
+                for (uint32_t j = 0; j < mediaCtx->pSurfaceHeap->uiAllocatedHeapElements && mediaSurfaceHeapElmt != nullptr &&
+                                     numUpdated < boToReport.size(); j++, mediaSurfaceHeapElmt++)
                 {
-                    // return failed if queried INCOMPLETE or UNAVAILABLE report.
-                    return VA_STATUS_ERROR_OPERATION_FAILED;
+                    if (mediaSurfaceHeapElmt->pSurface == nullptr)
+                    {
+                        continue;
+                    }
+                    auto it = boToReport.find(mediaSurfaceHeapElmt->pSurface->bo);
+                    if (it == boToReport.end())
+                    {
+                        continue;
+                    }
+
+                    DecodeStatusReportData &report = reports[it->second];
+                    mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.status   = (uint32_t)report.codecStatus;
+                    mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.errMbNum = (uint32_t)report.numMbsAffected;
+                    mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.crcValue = (uint32_t)report.frameCrc;
+                    mediaSurfaceHeapElmt->pSurface->curStatusReportQueryState       = DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED;
+                    numUpdated++;
                 }
             }
+
+            // return failed if queried INCOMPLETE or UNAVAILABLE report.
+            if (!reportValid)
+            {
+                return VA_STATUS_ERROR_OPERATION_FAILED;
+            }
         }
         // The surface is not busy in HW, but uNumCompletedReport is 0, treat as engine reset 
         else
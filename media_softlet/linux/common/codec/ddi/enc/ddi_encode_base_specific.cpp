@@ -28,6 +28,7 @@
 #include "ddi_encode_base_specific.h"
 #include "media_libva_util_next.h"
 #include "media_libva_interface_next.h"
+#include "media_user_setting.h"
 namespace encode
 {
 
@@ -135,6 +136,19 @@ VAStatus DdiEncodeBase::InitCompBuffer()
     }
     bufMgr->pCodedBufferSegment->next = nullptr;
 
+    // Coded buffer is read back by application through CPU, a WB mapping avoids
+    // the uncached read cost of the default allocation for high bitrate streams.
+    if (mediaCtx != nullptr)
+    {
+        uint32_t codedBufCpuCacheable = 0;
+        ReadUserSetting(
+            mediaCtx->m_userSettingPtr,
+            codedBufCpuCacheable,
+            "Encode Coded Buffer CPU Cacheable",
+            MediaUserSetting::Group::Device);
+        m_codedBufCpuCacheable = codedBufCpuCacheable ? true : false;
+    }
+
     DDI_CODEC_CHK_RET(m_encodeCtx->pCpDdiInterfaceNext->InitHdcp2Buffer(bufMgr), "fail to init hdcp2 buffer!");
 
     return VA_STATUS_SUCCESS;
@@ -916,8 +930,10 @@ VAStatus DdiEncodeBase::CreateBuffer(
     case VAProbabilityBufferType:
     case VAEncCodedBufferType:
     {
-        buf->iSize  = size;
-        buf->format = Media_Format_Buffer;
+        buf->iSize         = size;
+        buf->format        = Media_Format_Buffer;
+        buf->bCpuCacheable = m_codedBufCpuCacheable;
+        buf->bUseSysGfxMem = m_codedBufCpuCacheable;
         va           = MediaLibvaUtilNext::CreateBuffer(buf, mediaCtx->pDrmBufMgr);
         if (va != VA_STATUS_SUCCESS)
         {
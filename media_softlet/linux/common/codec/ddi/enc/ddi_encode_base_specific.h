@@ -580,6 +580,7 @@ protected:
     void CleanUpBufferandReturn(DDI_MEDIA_BUFFER *buf);
 
     bool    m_cpuFormat              = false;    //!< Flag for cpuFormat.
+    bool    m_codedBufCpuCacheable   = false;    //!< Flag to allocate coded buffer in CPU cacheable system memory.
     bool    m_newSeqHeader           = false;    //!< Flag for new Sequence Header.
     bool    m_newPpsHeader           = false;    //!< Flag for new Pps Header.
     bool    m_arbitraryNumMbsInSlice = false;    //!< Flag to indicate if the sliceMapSurface needs to be programmed or not.
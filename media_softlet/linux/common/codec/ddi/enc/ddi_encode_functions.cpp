@@ -678,7 +678,6 @@ VAStatus DdiEncodeFunctions::DestroyBuffer (
         case VAEncMacroblockMapBufferType:
             MediaLibvaUtilNext::FreeBuffer(buf);
             break;
-#ifdef ENABLE_ENC_UNLIMITED_OUTPUT
         case VAEncCodedBufferType:
             if(nullptr == encCtx)
             {
@@ -686,9 +685,27 @@ VAStatus DdiEncodeFunctions::DestroyBuffer (
                 if(nullptr == encCtx)
                     return VA_STATUS_ERROR_INVALID_CONTEXT;
             }
+            if (buf->uiExportcount)
+            {
+                // Coded buffer exported through vaAcquireBufferHandle may still be read by application,
+                // the buffer is freed on the last vaReleaseBufferHandle.
+                if (buf->bMapped)
+                {
+                    MediaLibvaUtilNext::UnlockBuffer(buf);
+                }
+                MediaLibvaUtilNext::UnRefBufObjInMediaBuffer(buf);
+                // Only bo and export handle are used by vaReleaseBufferHandle, release GMM info now as FreeBuffer does.
+                if (nullptr != buf->pMediaCtx && nullptr != buf->pMediaCtx->pGmmClientContext && nullptr != buf->pGmmResourceInfo)
+                {
+                    buf->pMediaCtx->pGmmClientContext->DestroyResInfoObject(buf->pGmmResourceInfo);
+                    buf->pGmmResourceInfo = nullptr;
+                }
+                buf->bPostponedBufFree = true;
+                MOS_TraceEventExt(EVENT_VA_FREE_BUFFER, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
+                return VA_STATUS_SUCCESS;
+            }
             MediaLibvaUtilNext::FreeBuffer(buf);
             break;
-#endif
         case VAStatsStatisticsParameterBufferType:
             MOS_DeleteArray(buf->pData);
             break;
@@ -304,6 +304,7 @@ typedef struct _DDI_MEDIA_BUFFER
 
     bool                   bCFlushReq        = false; // No LLC between CPU & GPU, requries to call CPU Flush for CPU mapped buffer
     bool                   bUseSysGfxMem     = false;
+    bool                   bCpuCacheable     = false; // Buffer is read back by CPU, allocate it cacheable so that it is mapped WB
     PDDI_MEDIA_SURFACE     pSurface          = nullptr;
     GMM_RESOURCE_INFO     *pGmmResourceInfo  = nullptr; // GMM resource descriptor
     PDDI_MEDIA_CONTEXT     pMediaCtx         = nullptr; // Media driver Context
@@ -92,6 +92,18 @@ void MediaLibvaInterfaceNext::DestroyMediaContextMutex(PDDI_MEDIA_CONTEXT mediaC
     return;
 }
 
+void MediaLibvaInterfaceNext::TraceInitPhase(InitPhase phase, uint64_t &phaseStart)
+{
+    uint64_t phaseEnd = 0;
+    MosUtilities::MosQueryPerformanceCounter(&phaseEnd);
+
+    uint32_t phaseId    = phase;
+    uint64_t phaseTicks = phaseEnd - phaseStart;
+    MOS_TraceEventExt(EVENT_DDI_INIT_PHASE, EVENT_TYPE_INFO, &phaseId, sizeof(phaseId), &phaseTicks, sizeof(phaseTicks));
+
+    phaseStart = phaseEnd;
+}
+
 PDDI_MEDIA_CONTEXT MediaLibvaInterfaceNext::CreateMediaDriverContext()
 {
     PDDI_MEDIA_CONTEXT   mediaCtx;
@@ -312,6 +324,9 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
 
     mediaCtx->m_userSettingPtr  = std::make_shared<MediaUserSetting::MediaUserSetting>();
 
+    uint64_t phaseStart = 0;
+    MosUtilities::MosQueryPerformanceCounter(&phaseStart);
+
     MOS_CONTEXT mosCtx          = {};
     mosCtx.fd                   = mediaCtx->fd;
     mosCtx.m_userSettingPtr     = mediaCtx->m_userSettingPtr;
@@ -354,6 +369,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
     mediaCtx->pMediaMemDecompState      = *mosCtx.ppMediaMemDecompState;
 
     mediaCtx->pMediaCopyState           = *mosCtx.ppMediaCopyState;
+    TraceInitPhase(initPhaseOsDevice, phaseStart);
 
     if (HeapInitialize(mediaCtx) != VA_STATUS_SUCCESS)
     {
@@ -361,6 +377,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    TraceInitPhase(initPhaseHeap, phaseStart);
 
     mediaCtx->m_hwInfo = MediaInterfacesHwInfoDevice::CreateFactory(mediaCtx->platform);
     if(!mediaCtx->m_hwInfo)
@@ -370,6 +387,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    TraceInitPhase(initPhaseHwInfo, phaseStart);
 
     mediaCtx->m_capsNext = MediaLibvaCapsNext::CreateCaps(mediaCtx);
     if (!mediaCtx->m_capsNext)
@@ -386,6 +404,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
     }
 
     ctx->max_image_formats = mediaCtx->m_capsNext->GetImageFormatsMaxNum();
+    TraceInitPhase(initPhaseCaps, phaseStart);
 
 #if !defined(ANDROID) && defined(X11_FOUND)
     MediaLibvaUtilNext::InitMutex(&mediaCtx->PutSurfaceRenderMutex);
@@ -425,6 +444,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    TraceInitPhase(initPhaseCompList, phaseStart);
 
     MosUtilities::MosUnlockMutex(&m_GlobalMutex);
 
@@ -1498,13 +1518,9 @@ void MediaLibvaInterfaceNext::CopyPlane(
     uint32_t srcPitch,
     uint32_t height)
 {
+    // Either side can be a write combined mapping of surface.
     uint32_t rowSize = std::min(dstPitch, srcPitch);
-    for (int y = 0; y < height; y += 1)
-    {
-        MOS_SecureMemcpy(dst, rowSize, src, rowSize);
-        dst += dstPitch;
-        src += srcPitch;
-    }
+    MOS_StreamingMemcpy2D(dst, dstPitch, src, srcPitch, rowSize, height);
 }
 
 VAStatus MediaLibvaInterfaceNext::CopySurfaceToImage(
@@ -1823,11 +1839,11 @@ VAStatus MediaLibvaInterfaceNext::PutImage(
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
         if (tempMediaSurface->data_size >= vaimg->data_size)
         {
-            eStatus = MOS_SecureMemcpy(tempSurfData, tempMediaSurface->data_size, imageData, vaimg->data_size);
+            eStatus = MOS_StreamingMemcpy(tempSurfData, tempMediaSurface->data_size, imageData, vaimg->data_size);
         }
         else
         {
-            eStatus = MOS_SecureMemcpy(tempSurfData, tempMediaSurface->data_size, imageData, tempMediaSurface->data_size);
+            eStatus = MOS_StreamingMemcpy(tempSurfData, tempMediaSurface->data_size, imageData, tempMediaSurface->data_size);
         }
 
         if (eStatus != MOS_STATUS_SUCCESS)
@@ -1904,7 +1920,7 @@ VAStatus MediaLibvaInterfaceNext::PutImage(
             (vaimg->num_planes > 1 && vaimg->offsets[1] == mediaSurface->iPitch * mediaSurface->iHeight)))
         {
             //Copy data from image to surface
-            MOS_STATUS eStatus = MOS_SecureMemcpy(surfData, vaimg->data_size, imageData, vaimg->data_size);
+            MOS_STATUS eStatus = MOS_StreamingMemcpy(surfData, vaimg->data_size, imageData, vaimg->data_size);
             DDI_CHK_CONDITION((eStatus != MOS_STATUS_SUCCESS), "Failed to copy image to surface buffer.", VA_STATUS_ERROR_OPERATION_FAILED);
         }
         else
@@ -1613,6 +1613,28 @@ private:
     //!
     static VAStatus HeapInitialize(PDDI_MEDIA_CONTEXT mediaCtx);
 
+    //!
+    //! \brief  Phases of driver initialization reported by EVENT_DDI_INIT_PHASE
+    //!
+    enum InitPhase
+    {
+        initPhaseOsDevice = 0,  //!< OS utilities and MOS device context
+        initPhaseHeap,          //!< DDI heaps
+        initPhaseHwInfo,        //!< HW info factory
+        initPhaseCaps,          //!< Caps table
+        initPhaseCompList,      //!< Component functions
+    };
+
+    //!
+    //! \brief  Trace the elapsed time of one initialization phase
+    //!
+    //! \param  [in] phase
+    //!         Initialization phase
+    //! \param  [in, out] phaseStart
+    //!         Performance counter at the start of phase, updated to current counter
+    //!
+    static void TraceInitPhase(InitPhase phase, uint64_t &phaseStart);
+
     //!
     //! \brief  Get Plane Num
     //!
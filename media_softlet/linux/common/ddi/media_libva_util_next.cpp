@@ -37,6 +37,7 @@
 #include "media_libva_decoder.h"
 #include "media_libva_encoder.h"
 #include "memory_policy_manager.h"
+#include "mos_gmm_layout_cache.h"
 #include "drm_fourcc.h"
 
 // will remove when mtl open source
@@ -879,7 +880,7 @@ VAStatus MediaLibvaUtilNext::CreateInternalSurface(
         return status;
     }
     
-    mediaSurface->pGmmResourceInfo = gmmResourceInfo = mediaDrvCtx->pGmmClientContext->CreateResInfoObject(&gmmParams);
+    mediaSurface->pGmmResourceInfo = gmmResourceInfo = GmmLayoutCache::CreateResInfoObject(mediaDrvCtx->pGmmClientContext, &gmmParams);
     DDI_CHK_NULL(gmmResourceInfo, "Gmm create resource failed", VA_STATUS_ERROR_ALLOCATION_FAILED);
 
     uint32_t  gmmPitch  = (uint32_t)gmmResourceInfo->GetRenderPitch();
@@ -2001,7 +2002,7 @@ VAStatus MediaLibvaUtilNext::AllocateBuffer(
     gmmParams.Flags.Info.Linear     = true;
     gmmParams.Flags.Info.LocalOnly  = MEDIA_IS_SKU(&mediaBuffer->pMediaCtx->SkuTable, FtrLocalMemory);
 
-    if (isShadowBuffer)
+    if (isShadowBuffer || mediaBuffer->bCpuCacheable)
     {
         gmmParams.Flags.Info.Cacheable = true;
         gmmParams.Usage = GMM_RESOURCE_USAGE_STAGING;
@@ -2058,6 +2059,72 @@ VAStatus MediaLibvaUtilNext::AllocateBuffer(
     return hRes;
 }
 
+VAStatus MediaLibvaUtilNext::CreateUserptrBuffer(
+    DDI_MEDIA_BUFFER *buffer,
+    void             *addr,
+    MOS_BUFMGR       *bufmgr)
+{
+    DDI_FUNC_ENTER;
+    DDI_CHK_NULL(buffer,                               "nullptr buffer",                               VA_STATUS_ERROR_INVALID_BUFFER);
+    DDI_CHK_NULL(addr,                                 "nullptr addr",                                 VA_STATUS_ERROR_INVALID_PARAMETER);
+    DDI_CHK_NULL(buffer->pMediaCtx,                    "nullptr buffer->pMediaCtx",                    VA_STATUS_ERROR_INVALID_BUFFER);
+    DDI_CHK_NULL(buffer->pMediaCtx->pGmmClientContext, "nullptr buffer->pMediaCtx->pGmmClientContext", VA_STATUS_ERROR_INVALID_BUFFER);
+    DDI_CHK_CONDITION(((uintptr_t)addr & (MOS_PAGE_SIZE - 1)) != 0, "userptr is not page aligned", VA_STATUS_ERROR_INVALID_PARAMETER);
+    DDI_CHK_CONDITION(buffer->iSize <= 0, "invalid buffer size", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    int32_t size = MOS_ALIGN_CEIL(buffer->iSize, MOS_PAGE_SIZE);
+
+    // Application memory is system memory snooped by GPU.
+    GMM_RESCREATE_PARAMS gmmParams;
+    MOS_ZeroMemory(&gmmParams, sizeof(gmmParams));
+    gmmParams.BaseWidth             = 1;
+    gmmParams.BaseHeight            = 1;
+    gmmParams.ArraySize             = 0;
+    gmmParams.Type                  = RESOURCE_1D;
+    gmmParams.Format                = GMM_FORMAT_GENERIC_8BIT;
+    gmmParams.Flags.Gpu.Video       = true;
+    gmmParams.Flags.Info.Linear     = true;
+    gmmParams.Flags.Info.Cacheable  = true;
+    gmmParams.Usage                 = GMM_RESOURCE_USAGE_STAGING;
+
+    buffer->pGmmResourceInfo = buffer->pMediaCtx->pGmmClientContext->CreateResInfoObject(&gmmParams);
+    DDI_CHK_NULL(buffer->pGmmResourceInfo, "pGmmResourceInfo is nullptr", VA_STATUS_ERROR_INVALID_BUFFER);
+    buffer->pGmmResourceInfo->OverrideSize(size);
+    buffer->pGmmResourceInfo->OverrideBaseWidth(size);
+    buffer->pGmmResourceInfo->OverridePitch(size);
+
+    struct mos_drm_bo_alloc_userptr alloc_uptr;
+    alloc_uptr.name        = "Media Userptr Buffer";
+    alloc_uptr.addr        = addr;
+    alloc_uptr.tiling_mode = TILING_NONE;
+    alloc_uptr.stride      = size;
+    alloc_uptr.size        = size;
+    alloc_uptr.pat_index   = MosInterface::GetPATIndexFromGmm(buffer->pMediaCtx->pGmmClientContext, buffer->pGmmResourceInfo);
+
+    MOS_LINUX_BO *bo = mos_bo_alloc_userptr(bufmgr, &alloc_uptr);
+    if (bo == nullptr)
+    {
+        DDI_NORMALMESSAGE("Fail to wrap %8d bytes userptr resource.", size);
+        buffer->pMediaCtx->pGmmClientContext->DestroyResInfoObject(buffer->pGmmResourceInfo);
+        buffer->pGmmResourceInfo = nullptr;
+        return VA_STATUS_ERROR_ALLOCATION_FAILED;
+    }
+
+    buffer->format          = Media_Format_Buffer;
+    buffer->iSize           = size;
+    buffer->iRefCount       = 0;
+    buffer->bMapped         = false;
+    buffer->bo              = bo;
+    buffer->pData           = (uint8_t *)addr;
+    buffer->uiLockedBufID   = VA_INVALID_ID;
+    buffer->uiLockedImageID = VA_INVALID_ID;
+
+    uint32_t event[] = {bo->handle, Media_Format_Buffer, (uint32_t)size, 1, (uint32_t)size, (uint32_t)bo->size, 0, 0};
+    MOS_TraceEventExt(EVENT_VA_BUFFER, EVENT_TYPE_INFO, event, sizeof(event), &buffer->pGmmResourceInfo->GetResFlags(), sizeof(GMM_RESOURCE_FLAG));
+
+    return VA_STATUS_SUCCESS;
+}
+
 PDDI_MEDIA_BUFFER_HEAP_ELEMENT MediaLibvaUtilNext::AllocPMediaBufferFromHeap(PDDI_MEDIA_HEAP bufferHeap)
 {
     DDI_FUNC_ENTER;
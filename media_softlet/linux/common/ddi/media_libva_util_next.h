@@ -677,6 +677,27 @@ public:
         DDI_MEDIA_BUFFER *buffer,
         MOS_BUFMGR       *bufmgr);
 
+    //!
+    //! \brief  Create linear buffer which wraps application memory
+    //! \details The memory is used by GPU in place through a userptr bo, it
+    //!          must stay valid until the buffer is freed. Address must be
+    //!          page aligned, buffer->iSize is rounded up to page size.
+    //!
+    //! \param  [in, out] buffer
+    //!         Ddi media buffer, iSize, uiType and pMediaCtx are set by caller
+    //! \param  [in] addr
+    //!         Page aligned application memory
+    //! \param  [in] bufmgr
+    //!         Mos buffer manager
+    //!
+    //! \return VAStatus
+    //!     VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    static VAStatus CreateUserptrBuffer(
+        DDI_MEDIA_BUFFER *buffer,
+        void             *addr,
+        MOS_BUFMGR       *bufmgr);
+
     //!
     //! \brief  Allocate pmedia buffer from heap
     //! 
@@ -24,6 +24,9 @@
 //! \brief     The purpose of the file is to get the sku/wa table according to platform information. 
 //!
 
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
 #include "hwinfo_linux.h"
 #include "mos_utilities.h"
 #include "mos_util_debug.h"
@@ -82,6 +85,45 @@ MOS_STATUS HWInfo_GetGfxProductFamily(int32_t fd, PRODUCT_FAMILY &eProductFamily
     return MOS_STATUS_SUCCESS;
 }
 
+/*****************************************************************************\
+Description:
+    Get NUMA node which the device is attached to
+
+Input:
+    fd              - file descriptor to the /dev/dri/cardX or renderDX
+Output:
+    numaNode        - NUMA node of the device, -1 if the system is not NUMA
+                      or the node is unknown
+\*****************************************************************************/
+MOS_STATUS HWInfo_GetNumaNode(int32_t fd, int32_t &numaNode)
+{
+    numaNode = -1;
+
+    struct stat st = {};
+    if (fd < 0 || fstat(fd, &st) != 0 || !S_ISCHR(st.st_mode))
+    {
+        MOS_OS_ASSERTMESSAGE("Invalid parameter \n");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    char path[64] = {};
+    snprintf(path, sizeof(path), "/sys/dev/char/%u:%u/device/numa_node", major(st.st_rdev), minor(st.st_rdev));
+
+    FILE *fp = fopen(path, "r");
+    if (fp == nullptr)
+    {
+        // No numa_node for devices not on PCI, e.g. in virtual machines.
+        return MOS_STATUS_SUCCESS;
+    }
+    if (fscanf(fp, "%d", &numaNode) != 1)
+    {
+        numaNode = -1;
+    }
+    fclose(fp);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 
 /*****************************************************************************\
 Description:
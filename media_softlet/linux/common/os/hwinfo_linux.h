@@ -48,6 +48,8 @@
 
 extern MOS_STATUS HWInfo_GetGfxProductFamily(int32_t fd, PRODUCT_FAMILY &eProductFamily);
 
+extern MOS_STATUS HWInfo_GetNumaNode(int32_t fd, int32_t &numaNode);
+
 extern MOS_STATUS HWInfo_GetGfxInfo(int32_t    fd,
                           MOS_BUFMGR           *pDrmBufMgr,
                           PLATFORM             *gfxPlatform,
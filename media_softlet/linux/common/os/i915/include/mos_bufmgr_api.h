@@ -252,6 +252,24 @@ struct mos_drm_bo_alloc_prime {
     uint16_t pat_index;
 };
 
+/**
+ * CPU map statistics of a buffer manager.
+ *
+ * A CPU mapping is created on the first map of a bo and kept until the bo
+ * is freed, including across reuse from the bo cache, so map_count minus
+ * mmap_count is the number of maps served by an existing mapping.
+ */
+struct mos_bufmgr_map_stats {
+    uint64_t map_count = 0;         /* Map calls which returned a CPU address */
+    uint64_t mmap_count = 0;        /* Map calls which created a new CPU mapping */
+    uint64_t map_time_ns = 0;       /* Total time spent in map calls, including wait for GPU */
+    uint64_t max_map_time_ns = 0;
+    uint64_t prefault_count = 0;    /* New mappings prefaulted at map time */
+    uint64_t prefault_bytes = 0;
+    uint64_t prefault_time_ns = 0;
+    uint64_t prefault_faults = 0;   /* Minor page faults taken while prefaulting */
+};
+
 struct mos_drm_uc_version {
 #define UC_TYPE_GUC_SUBMISSION 0
 #define UC_TYPE_HUC            1
@@ -321,6 +339,8 @@ void mos_bufmgr_disable_object_capture(struct mos_bufmgr *bufmgr);
 int mos_bufmgr_get_memory_info(struct mos_bufmgr *bufmgr, char *info, uint32_t length);
 int mos_bufmgr_get_devid(struct mos_bufmgr *bufmgr);
 void mos_bufmgr_realloc_cache(struct mos_bufmgr *bufmgr, uint8_t alloc_mode);
+void mos_bufmgr_set_map_prefault(struct mos_bufmgr *bufmgr, uint64_t min_size);
+int mos_bufmgr_get_map_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_map_stats *stats);
 
 int mos_bo_map_unsynchronized(struct mos_linux_bo *bo);
 int mos_bo_map_gtt(struct mos_linux_bo *bo);
@@ -465,6 +485,7 @@ drm_export bool mos_bo_is_exec_object_async(struct mos_linux_bo *bo);
 uint64_t mos_get_platform_information(struct mos_bufmgr *bufmgr);
 void mos_set_platform_information(struct mos_bufmgr *bufmgr, uint64_t p);
 bool mos_has_bsd2(struct mos_bufmgr *bufmgr);
+bool mos_bufmgr_has_userptr(struct mos_bufmgr *bufmgr);
 int mos_get_ts_frequency(struct mos_bufmgr *bufmgr, uint32_t *ts_freq);
 void mos_enable_turbo_boost(struct mos_bufmgr *bufmgr);
 
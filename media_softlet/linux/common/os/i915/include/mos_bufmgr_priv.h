@@ -359,6 +359,16 @@ struct mos_bufmgr {
     int (*get_memory_info)(struct mos_bufmgr *bufmgr, char *info, uint32_t length) = nullptr;
     int (*get_devid)(struct mos_bufmgr *bufmgr) = nullptr;
     void (*realloc_cache)(struct mos_bufmgr *bufmgr, uint8_t alloc_mode) = nullptr;
+
+    /**
+     * Prefault new CPU mappings of at least min_size bytes at map time,
+     * 0 disables prefault.
+     */
+    void (*set_map_prefault)(struct mos_bufmgr *bufmgr, uint64_t min_size) = nullptr;
+
+    /** Get CPU map statistics since the buffer manager is created */
+    int (*get_map_stats)(struct mos_bufmgr *bufmgr, struct mos_bufmgr_map_stats *stats) = nullptr;
+
     int (*query_engines_count)(struct mos_bufmgr *bufmgr,
                           unsigned int *nengine) = nullptr;
     int (*query_engines)(struct mos_bufmgr *bufmgr,
@@ -429,4 +439,74 @@ struct mos_bufmgr {
 #define ROUND_UP_TO(x, y)    (((x) + (y) - 1) / (y) * (y))
 #define ROUND_UP_TO_MB(x)    ROUND_UP_TO((x), 1024*1024)
 
+#include <time.h>
+#include <sys/resource.h>
+
+/**
+ * CPU map bookkeeping shared by bufmgr backends. Each backend owns one
+ * instance and only touches it with its bufmgr lock held.
+ */
+struct mos_bufmgr_map_tracker {
+    /** Minimum size of a new mapping to prefault, 0 to disable */
+    uint64_t prefault_min_size = 0;
+    struct mos_bufmgr_map_stats stats;
+};
+
+static inline uint64_t
+mos_bufmgr_map_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline uint64_t
+mos_bufmgr_map_minor_faults(void)
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_THREAD, &usage) != 0)
+        return 0;
+    return (uint64_t)usage.ru_minflt;
+}
+
+/**
+ * Account one successful map call which started at start_ns.
+ *
+ * new_virt is the CPU mapping created by this call, or nullptr if an
+ * existing mapping is returned. GEM mmaps are VM_PFNMAP/VM_MIXEDMAP, so
+ * MAP_POPULATE and MADV_POPULATE_* do not populate them; instead one byte
+ * per page is read here so the faults are taken once at map time rather
+ * than on the first CPU access of each page by the caller.
+ */
+static inline void
+mos_bufmgr_map_track(struct mos_bufmgr_map_tracker *tracker,
+                     void *new_virt,
+                     uint64_t size,
+                     uint64_t start_ns)
+{
+    if (new_virt) {
+        tracker->stats.mmap_count++;
+
+        if (tracker->prefault_min_size && size >= tracker->prefault_min_size) {
+            uint64_t prefault_start = mos_bufmgr_map_time_ns();
+            uint64_t faults = mos_bufmgr_map_minor_faults();
+            volatile const uint8_t *ptr = (volatile const uint8_t *)new_virt;
+
+            for (uint64_t offset = 0; offset < size; offset += 4096)
+                (void)ptr[offset];
+
+            tracker->stats.prefault_count++;
+            tracker->stats.prefault_bytes += size;
+            tracker->stats.prefault_faults += mos_bufmgr_map_minor_faults() - faults;
+            tracker->stats.prefault_time_ns += mos_bufmgr_map_time_ns() - prefault_start;
+        }
+    }
+
+    uint64_t elapsed = mos_bufmgr_map_time_ns() - start_ns;
+    tracker->stats.map_count++;
+    tracker->stats.map_time_ns += elapsed;
+    if (elapsed > tracker->stats.max_map_time_ns)
+        tracker->stats.max_map_time_ns = elapsed;
+}
+
 #endif /* INTEL_BUFMGR_PRIV_H */
@@ -185,6 +185,8 @@ struct mos_bufmgr_gem {
     int device_type;
 
     uint32_t ts_freq;
+
+    struct mos_bufmgr_map_tracker map_tracker;
 } mos_bufmgr_gem;
 
 #define DRM_INTEL_RELOC_FENCE (1<<0)
@@ -1880,10 +1882,12 @@ mos_gem_bo_map_wc(struct mos_linux_bo *bo) {
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
     struct drm_i915_gem_set_domain set_domain;
     struct drm_i915_gem_wait wait;
+    uint64_t start_ns = mos_bufmgr_map_time_ns();
     int ret;
 
     pthread_mutex_lock(&bufmgr_gem->lock);
 
+    void *prev_virtual = bo_gem->mem_wc_virtual;
     ret = map_wc(bo);
     if (ret) {
         pthread_mutex_unlock(&bufmgr_gem->lock);
@@ -1923,6 +1927,9 @@ mos_gem_bo_map_wc(struct mos_linux_bo *bo) {
         }
     }
 
+    mos_bufmgr_map_track(&bufmgr_gem->map_tracker,
+                         prev_virtual ? nullptr : bo_gem->mem_wc_virtual,
+                         bo->size, start_ns);
     mos_gem_bo_mark_mmaps_incoherent(bo);
     VG(VALGRIND_MAKE_MEM_DEFINED(bo_gem->mem_wc_virtual, bo->size));
     pthread_mutex_unlock(&bufmgr_gem->lock);
@@ -1951,8 +1958,10 @@ drm_export int mos_gem_bo_map(struct mos_linux_bo *bo, int write_enable)
         return mos_gem_bo_map_wc(bo);
     }
 
+    uint64_t start_ns = mos_bufmgr_map_time_ns();
     pthread_mutex_lock(&bufmgr_gem->lock);
 
+    void *prev_virtual = bo_gem->mem_virtual;
     if (bufmgr_gem->has_mmap_offset) {
         struct drm_i915_gem_wait wait;
 
@@ -2061,6 +2070,9 @@ drm_export int mos_gem_bo_map(struct mos_linux_bo *bo, int write_enable)
     if (write_enable)
         bo_gem->mapped_cpu_write = true;
 
+    mos_bufmgr_map_track(&bufmgr_gem->map_tracker,
+                         prev_virtual ? nullptr : bo_gem->mem_virtual,
+                         bo->size, start_ns);
     mos_gem_bo_mark_mmaps_incoherent(bo);
     VG(VALGRIND_MAKE_MEM_DEFINED(bo_gem->mem_virtual, bo->size));
     pthread_mutex_unlock(&bufmgr_gem->lock);
@@ -3893,6 +3905,28 @@ init_cache_buckets(struct mos_bufmgr_gem *bufmgr_gem)
     }
 }
 
+static void
+mos_gem_set_map_prefault(struct mos_bufmgr *bufmgr, uint64_t min_size)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    bufmgr_gem->map_tracker.prefault_min_size = min_size;
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+}
+
+static int
+mos_gem_get_map_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_map_stats *stats)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bufmgr;
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    *stats = bufmgr_gem->map_tracker.stats;
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+
+    return 0;
+}
+
 static void
 mos_gem_realloc_cache(struct mos_bufmgr *bufmgr, uint8_t alloc_mode)
 {
@@ -5307,6 +5341,8 @@ mos_bufmgr_gem_init_i915(int fd, int batch_size)
     bufmgr_gem->bufmgr.get_memory_info = mos_gem_get_memory_info;
     bufmgr_gem->bufmgr.get_devid = mos_gem_get_devid;
     bufmgr_gem->bufmgr.realloc_cache = mos_gem_realloc_cache;
+    bufmgr_gem->bufmgr.set_map_prefault = mos_gem_set_map_prefault;
+    bufmgr_gem->bufmgr.get_map_stats = mos_gem_get_map_stats;
     bufmgr_gem->bufmgr.set_context_param = mos_gem_set_context_param;
     bufmgr_gem->bufmgr.set_context_param_parallel = mos_gem_set_context_param_parallel;
     bufmgr_gem->bufmgr.set_context_param_load_balance = mos_gem_set_context_param_load_balance;
@@ -1223,6 +1223,42 @@ mos_bufmgr_realloc_cache(struct mos_bufmgr *bufmgr, uint8_t alloc_mode)
     }
 }
 
+void
+mos_bufmgr_set_map_prefault(struct mos_bufmgr *bufmgr, uint64_t min_size)
+{
+    if(!bufmgr)
+    {
+        MOS_OS_CRITICALMESSAGE("Input null ptr\n");
+        return;
+    }
+
+    // Optional op, bufmgrs without it simply keep the default map behavior
+    if (bufmgr->set_map_prefault)
+    {
+        return bufmgr->set_map_prefault(bufmgr, min_size);
+    }
+}
+
+int
+mos_bufmgr_get_map_stats(struct mos_bufmgr *bufmgr, struct mos_bufmgr_map_stats *stats)
+{
+    if(!bufmgr || !stats)
+    {
+        MOS_OS_CRITICALMESSAGE("Input null ptr\n");
+        return -EINVAL;
+    }
+
+    // Optional op, queried on every context destroy so fail quietly
+    if (bufmgr->get_map_stats)
+    {
+        return bufmgr->get_map_stats(bufmgr, stats);
+    }
+    else
+    {
+        return -EPERM;
+    }
+}
+
 int
 mos_query_engines_count(struct mos_bufmgr *bufmgr,
                       unsigned int *nengine)
@@ -1445,6 +1481,13 @@ mos_has_bsd2(struct mos_bufmgr *bufmgr)
     }
 }
 
+bool
+mos_bufmgr_has_userptr(struct mos_bufmgr *bufmgr)
+{
+    // Capability query, a bufmgr without userptr support is not an error.
+    return bufmgr && bufmgr->bo_alloc_userptr;
+}
+
 void
 mos_enable_turbo_boost(struct mos_bufmgr *bufmgr)
 {
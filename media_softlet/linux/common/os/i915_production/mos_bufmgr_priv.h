@@ -359,6 +359,16 @@ struct mos_bufmgr {
     int (*get_memory_info)(struct mos_bufmgr *bufmgr, char *info, uint32_t length) = nullptr;
     int (*get_devid)(struct mos_bufmgr *bufmgr) = nullptr;
     void (*realloc_cache)(struct mos_bufmgr *bufmgr, uint8_t alloc_mode) = nullptr;
+
+    /**
+     * Prefault new CPU mappings of at least min_size bytes at map time,
+     * 0 disables prefault.
+     */
+    void (*set_map_prefault)(struct mos_bufmgr *bufmgr, uint64_t min_size) = nullptr;
+
+    /** Get CPU map statistics since the buffer manager is created */
+    int (*get_map_stats)(struct mos_bufmgr *bufmgr, struct mos_bufmgr_map_stats *stats) = nullptr;
+
     int (*query_engines_count)(struct mos_bufmgr *bufmgr,
                           unsigned int *nengine) = nullptr;
     
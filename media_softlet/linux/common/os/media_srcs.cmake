@@ -52,6 +52,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/mos_vma.c
     ${CMAKE_CURRENT_LIST_DIR}/mos_oca_specific.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mos_auxtable_mgr.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/mos_gmm_layout_cache.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mos_interface.cpp
 )
 
@@ -69,6 +70,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/mos_oca_defs_specific.h
     ${CMAKE_CURRENT_LIST_DIR}/mos_oca_interface_specific.h
     ${CMAKE_CURRENT_LIST_DIR}/mos_auxtable_mgr.h
+    ${CMAKE_CURRENT_LIST_DIR}/mos_gmm_layout_cache.h
     ${CMAKE_CURRENT_LIST_DIR}/mos_vma.h
 )
 
@@ -42,6 +42,8 @@ MOS_STATUS  CommandBufferSpecificNext::Allocate(OsContextNext *osContext, uint32
     }
 
     m_osContext = osContext;
+    m_mapped    = false;
+    m_gpuIdle   = true;
 
     GraphicsResourceNext::CreateParams params;
     params.m_tileType  = MOS_TILE_LINEAR;
@@ -73,6 +75,12 @@ void  CommandBufferSpecificNext::Free()
         return;
     }
 
+    if (m_mapped)
+    {
+        m_graphicsResource->Unlock(m_osContext);
+        m_mapped = false;
+    }
+
     m_graphicsResource->Free(m_osContext, 0);
     MOS_Delete(m_graphicsResource);
 }
@@ -84,10 +92,22 @@ MOS_STATUS CommandBufferSpecificNext::BindToGpuContext(GpuContextNext *gpuContex
     MOS_OS_CHK_NULL_RETURN(gpuContext);
     MOS_OS_CHK_NULL_RETURN(m_graphicsResource);
 
-    GraphicsResourceNext::LockParams params;
-    params.m_writeRequest = true;
-    auto lockAddr = static_cast<uint8_t *>(m_graphicsResource->Lock(m_osContext, params));
-    MOS_OS_CHK_NULL_RETURN(lockAddr);
+    if (!m_mapped)
+    {
+        GraphicsResourceNext::LockParams params;
+        params.m_writeRequest = true;
+        auto lockAddr = static_cast<uint8_t *>(m_graphicsResource->Lock(m_osContext, params));
+        MOS_OS_CHK_NULL_RETURN(lockAddr);
+        m_mapped = true;
+    }
+    else if (!m_gpuIdle)
+    {
+        // Returned to pool without waitReady(), e.g. by CmdBufMgrNext::Reset.
+        waitReady();
+    }
+    // Caller fills and submits the buffer, so GPU may use it from now on.
+    m_gpuIdle = false;
+
     m_gpuContext        = gpuContext;
     m_gpuContextHandle  = gpuContext->GetGpuContextHandle();
 
@@ -139,6 +159,7 @@ void CommandBufferSpecificNext::waitReady()
     }
 
     mos_bo_wait_rendering(cmdBufBo);
+    m_gpuIdle = true;
 }
 
 void CommandBufferSpecificNext::UnBindToGpuContext(bool isNative)
@@ -163,8 +184,7 @@ void CommandBufferSpecificNext::UnBindToGpuContext(bool isNative)
         return;
     }
 
-    m_graphicsResource->Unlock(m_osContext);
-
+    // Resource stays locked for next bind, it is unlocked in Free().
     m_readyToUse = false;
 }
 
@@ -32,6 +32,11 @@
 //!
 //! \class  CommandBufferSpecific
 //! \brief  Linux/Android specific command buffer 
+//! \details The resource is locked on first bind and stays mapped until it
+//!          is freed, so binding a recycled buffer is a pointer handoff.
+//!          As map no longer waits for GPU on rebind, the buffer tracks its
+//!          own fence: it is idle after allocation or waitReady(), and busy
+//!          from bind on. Binding a buffer not known to be idle waits first.
 //!
 class CommandBufferSpecificNext : public CommandBufferNext
 {
@@ -72,6 +77,11 @@ public:
     //! \detail   This function will call mos_bo_wait_rendering()
     //!
     void waitReady();
+
+protected:
+    bool m_mapped  = false;  //!< Resource is locked for CPU write since first bind
+    bool m_gpuIdle = true;   //!< No submission using this buffer may be pending on GPU
+
 MEDIA_CLASS_DEFINE_END(CommandBufferSpecificNext)
 };
 #endif // __COMMAND_BUFFER_SPECIFIC_NEXT_H__
@@ -48,6 +48,7 @@
 #include "mos_cmdbufmgr_next.h"
 #include "mos_oca_rtlog_mgr.h"
 #include "mos_oca_interface_specific.h"
+#include "mos_gmm_layout_cache.h"
 #define BATCH_BUFFER_SIZE 0x80000
 
 OsContextSpecificNext::OsContextSpecificNext()
@@ -186,6 +187,35 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
             }
         }
 
+        ReadUserSetting(
+            userSettingPtr,
+            value,
+            "Map Prefault Min Size KB",
+            MediaUserSetting::Group::Device);
+
+        if (value)
+        {
+            mos_bufmgr_set_map_prefault(m_bufmgr, (uint64_t)value * 1024);
+        }
+
+        int32_t numaNode = -1;
+        if (!GetNullHwIsEnabled() && HWInfo_GetNumaNode(m_fd, numaNode) == MOS_STATUS_SUCCESS)
+        {
+            uint32_t numaThreadAffinity = 0;
+            ReadUserSetting(
+                userSettingPtr,
+                value,
+                "NUMA Local Allocation",
+                MediaUserSetting::Group::Device);
+            ReadUserSetting(
+                userSettingPtr,
+                numaThreadAffinity,
+                "NUMA Thread Affinity",
+                MediaUserSetting::Group::Device);
+
+            MosUtilities::MosSetNumaNode(numaNode, value != 0, numaThreadAffinity != 0);
+        }
+
         uint64_t isRecoverableContextEnabled = 0;
         MOS_LINUX_CONTEXT *intel_context = mos_context_create_ext(m_bufmgr, 0, false);
         int ret = mos_get_context_param(intel_context, 0, DRM_CONTEXT_PARAM_RECOVERABLE, &isRecoverableContextEnabled);
@@ -258,6 +288,25 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
         }
         m_gmmClientContext = gmmOutArgs.pGmmClientContext;
 
+        bool disableGmmLayoutCache = false;
+        ReadUserSetting(
+            userSettingPtr,
+            disableGmmLayoutCache,
+            "Disable GMM Layout Cache",
+            MediaUserSetting::Group::Device);
+        if (!disableGmmLayoutCache)
+        {
+            bool validateGmmLayoutCache = false;
+#if (_DEBUG || _RELEASE_INTERNAL)
+            ReadUserSettingForDebug(
+                userSettingPtr,
+                validateGmmLayoutCache,
+                "GMM Layout Cache Validate",
+                MediaUserSetting::Group::Device);
+#endif
+            GmmLayoutCache::Register(m_gmmClientContext, validateGmmLayoutCache);
+        }
+
         m_auxTableMgr = AuxTableMgr::CreateAuxTableMgr(m_bufmgr, &m_skuTable, m_gmmClientContext);
 
 #if (_DEBUG || _RELEASE_INTERNAL)
@@ -359,8 +408,28 @@ void OsContextSpecificNext::Destroy()
         m_skuTable.reset();
         m_waTable.reset();
 
+        struct mos_bufmgr_map_stats mapStats;
+        if (mos_bufmgr_get_map_stats(m_bufmgr, &mapStats) == 0)
+        {
+            MOS_TraceEventExt(EVENT_MOS_BO_MAP_STATS, EVENT_TYPE_INFO, &mapStats, sizeof(mapStats), nullptr, 0);
+            MOS_OS_NORMALMESSAGE("Bo map: %llu calls, %llu new mappings, %llu ns total, %llu ns max, %llu prefaulted (%llu bytes, %llu faults, %llu ns)",
+                (unsigned long long)mapStats.map_count,
+                (unsigned long long)mapStats.mmap_count,
+                (unsigned long long)mapStats.map_time_ns,
+                (unsigned long long)mapStats.max_map_time_ns,
+                (unsigned long long)mapStats.prefault_count,
+                (unsigned long long)mapStats.prefault_bytes,
+                (unsigned long long)mapStats.prefault_faults,
+                (unsigned long long)mapStats.prefault_time_ns);
+        }
+
+        MosUtilities::MosReportNumaMemory();
+
         mos_bufmgr_destroy(m_bufmgr);
 
+        // Cached layouts belong to Gmm context, release them first
+        GmmLayoutCache::Unregister(m_gmmClientContext);
+
         // Delete Gmm context
         GMM_INIT_OUT_ARGS gmmOutArgs = {};
         gmmOutArgs.pGmmClientContext = m_gmmClientContext;
@@ -0,0 +1,226 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_gmm_layout_cache.cpp
+//! \brief    Implements cache of GMM resource layouts
+//!
+
+#include "mos_gmm_layout_cache.h"
+#include "mos_util_debug.h"
+
+std::mutex                                       GmmLayoutCache::m_mutex;
+std::map<GMM_CLIENT_CONTEXT *, GmmLayoutCache *> GmmLayoutCache::m_caches;
+
+GmmLayoutCache::GmmLayoutCache(GMM_CLIENT_CONTEXT *gmmClientContext, bool validate) :
+    m_gmmClientContext(gmmClientContext),
+    m_validate(validate)
+{
+}
+
+GmmLayoutCache::~GmmLayoutCache()
+{
+    for (auto &entry : m_entries)
+    {
+        m_gmmClientContext->DestroyResInfoObject(entry.second);
+    }
+    m_entries.clear();
+}
+
+MOS_STATUS GmmLayoutCache::Register(GMM_CLIENT_CONTEXT *gmmClientContext, bool validate)
+{
+    MOS_OS_CHK_NULL_RETURN(gmmClientContext);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_caches.find(gmmClientContext) != m_caches.end())
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    GmmLayoutCache *cache = MOS_New(GmmLayoutCache, gmmClientContext, validate);
+    MOS_OS_CHK_NULL_RETURN(cache);
+    m_caches.insert(std::make_pair(gmmClientContext, cache));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void GmmLayoutCache::Unregister(GMM_CLIENT_CONTEXT *gmmClientContext)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_caches.find(gmmClientContext);
+    if (it == m_caches.end())
+    {
+        return;
+    }
+
+    GmmLayoutCache *cache = it->second;
+    MOS_OS_NORMALMESSAGE("GMM layout cache: %llu hits, %llu misses, %llu validation failures, %u entries",
+        (unsigned long long)cache->m_stats.hitCount,
+        (unsigned long long)cache->m_stats.missCount,
+        (unsigned long long)cache->m_stats.validateFailCount,
+        (uint32_t)cache->m_entries.size());
+
+    m_caches.erase(it);
+    MOS_Delete(cache);
+}
+
+bool GmmLayoutCache::GetStatistics(GMM_CLIENT_CONTEXT *gmmClientContext, Statistics &stats)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_caches.find(gmmClientContext);
+    if (it == m_caches.end())
+    {
+        return false;
+    }
+
+    stats            = it->second->m_stats;
+    stats.entryCount = (uint32_t)it->second->m_entries.size();
+    return true;
+}
+
+bool GmmLayoutCache::IsCacheable(const GMM_RESCREATE_PARAMS &gmmParams)
+{
+    // Layout of resources backed by client memory depends on that memory.
+    return !gmmParams.Flags.Info.ExistingSysMem &&
+           gmmParams.pExistingSysMem == 0 &&
+           gmmParams.ExistingSysMemSize == 0;
+}
+
+bool GmmLayoutCache::IsSameLayout(GMM_RESOURCE_INFO *cached, GMM_RESOURCE_INFO *fresh)
+{
+    return cached->GetSizeSurface() == fresh->GetSizeSurface() &&
+           cached->GetSizeMainSurface() == fresh->GetSizeMainSurface() &&
+           cached->GetRenderPitch() == fresh->GetRenderPitch() &&
+           cached->GetQPitch() == fresh->GetQPitch() &&
+           cached->GetBaseWidth() == fresh->GetBaseWidth() &&
+           cached->GetBaseHeight() == fresh->GetBaseHeight() &&
+           cached->GetBaseDepth() == fresh->GetBaseDepth() &&
+           cached->GetTileType() == fresh->GetTileType() &&
+           cached->GetPlanarXOffset(GMM_PLANE_U) == fresh->GetPlanarXOffset(GMM_PLANE_U) &&
+           cached->GetPlanarYOffset(GMM_PLANE_U) == fresh->GetPlanarYOffset(GMM_PLANE_U) &&
+           cached->GetPlanarXOffset(GMM_PLANE_V) == fresh->GetPlanarXOffset(GMM_PLANE_V) &&
+           cached->GetPlanarYOffset(GMM_PLANE_V) == fresh->GetPlanarYOffset(GMM_PLANE_V) &&
+           cached->GetPlanarAuxOffset(0, GMM_AUX_Y_CCS) == fresh->GetPlanarAuxOffset(0, GMM_AUX_Y_CCS) &&
+           cached->GetPlanarAuxOffset(0, GMM_AUX_UV_CCS) == fresh->GetPlanarAuxOffset(0, GMM_AUX_UV_CCS);
+}
+
+GMM_RESOURCE_INFO *GmmLayoutCache::CreateResInfoObject(GMM_CLIENT_CONTEXT *gmmClientContext, GMM_RESCREATE_PARAMS *gmmParams)
+{
+    if (gmmClientContext == nullptr || gmmParams == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!IsCacheable(*gmmParams))
+    {
+        return gmmClientContext->CreateResInfoObject(gmmParams);
+    }
+
+    Key key;
+    MOS_ZeroMemory(&key, sizeof(key));
+    MOS_SecureMemcpy(&key.params, sizeof(key.params), gmmParams, sizeof(*gmmParams));
+
+    GMM_RESOURCE_INFO *resInfo  = nullptr;
+    bool               validate = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto cacheIt = m_caches.find(gmmClientContext);
+        if (cacheIt == m_caches.end())
+        {
+            return gmmClientContext->CreateResInfoObject(gmmParams);
+        }
+
+        GmmLayoutCache *cache = cacheIt->second;
+        auto            it    = cache->m_entries.find(key);
+        if (it != cache->m_entries.end())
+        {
+            resInfo = gmmClientContext->CopyResInfoObject(it->second);
+            if (resInfo != nullptr)
+            {
+                cache->m_stats.hitCount++;
+                validate = cache->m_validate;
+            }
+        }
+    }
+
+    if (resInfo != nullptr && !validate)
+    {
+        return resInfo;
+    }
+
+    // Layout math runs out of the lock, it's the expensive part.
+    GMM_RESOURCE_INFO *fresh = gmmClientContext->CreateResInfoObject(gmmParams);
+    if (fresh == nullptr)
+    {
+        if (resInfo != nullptr)
+        {
+            gmmClientContext->DestroyResInfoObject(resInfo);
+        }
+        return nullptr;
+    }
+
+    if (resInfo != nullptr)
+    {
+        // Validation mode, hand out the fresh layout and report any difference.
+        bool same = IsSameLayout(resInfo, fresh);
+        gmmClientContext->DestroyResInfoObject(resInfo);
+        if (!same)
+        {
+            MOS_OS_ASSERTMESSAGE("Cached GMM layout differs from fresh one, format %d, %llux%u",
+                gmmParams->Format, (unsigned long long)gmmParams->BaseWidth64, gmmParams->BaseHeight);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto cacheIt = m_caches.find(gmmClientContext);
+            if (cacheIt != m_caches.end())
+            {
+                cacheIt->second->m_stats.validateFailCount++;
+            }
+        }
+        return fresh;
+    }
+
+    GMM_RESOURCE_INFO *entry = gmmClientContext->CopyResInfoObject(fresh);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto cacheIt = m_caches.find(gmmClientContext);
+    if (cacheIt == m_caches.end())
+    {
+        if (entry != nullptr)
+        {
+            gmmClientContext->DestroyResInfoObject(entry);
+        }
+        return fresh;
+    }
+
+    GmmLayoutCache *cache = cacheIt->second;
+    cache->m_stats.missCount++;
+    // Cache is bounded, layouts seen after it is full are computed every time.
+    if (entry != nullptr &&
+        (cache->m_entries.size() >= m_maxEntryCount ||
+         !cache->m_entries.insert(std::make_pair(key, entry)).second))
+    {
+        gmmClientContext->DestroyResInfoObject(entry);
+    }
+
+    return fresh;
+}
@@ -0,0 +1,129 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_gmm_layout_cache.h
+//! \brief    Cache of GMM resource layouts per GMM client context
+//! \details  Creating GMM_RESOURCE_INFO recomputes the whole surface layout.
+//!           Allocation bursts (surface pools, resolution change, context
+//!           creation) ask for identical layouts many times, so the first
+//!           GMM_RESOURCE_INFO created for a set of GMM_RESCREATE_PARAMS is
+//!           kept as a template and later requests get a copy of it.
+//!
+#ifndef __MOS_GMM_LAYOUT_CACHE_H__
+#define __MOS_GMM_LAYOUT_CACHE_H__
+
+#include <map>
+#include <mutex>
+#include "mos_os.h"
+#include "media_class_trace.h"
+
+class GmmLayoutCache
+{
+public:
+    struct Statistics
+    {
+        uint64_t hitCount          = 0;
+        uint64_t missCount         = 0;
+        uint64_t validateFailCount = 0;  //!< Cached layouts which differ from fresh ones, validation mode only
+        uint32_t entryCount        = 0;
+    };
+
+    //!
+    //! \brief  Enable layout cache for GMM client context
+    //! \param  [in] gmmClientContext
+    //!         GMM client context of the device
+    //! \param  [in] validate
+    //!         Compare every cached layout with a freshly computed one
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    static MOS_STATUS Register(GMM_CLIENT_CONTEXT *gmmClientContext, bool validate);
+
+    //!
+    //! \brief  Destroy layout cache of GMM client context
+    //! \details Must be called before the GMM client context is destroyed.
+    //! \param  [in] gmmClientContext
+    //!         GMM client context of the device
+    //!
+    static void Unregister(GMM_CLIENT_CONTEXT *gmmClientContext);
+
+    //!
+    //! \brief  Create GMM resource info, from cache if possible
+    //! \details Drop-in replacement of GMM_CLIENT_CONTEXT::CreateResInfoObject,
+    //!          result must be destroyed by DestroyResInfoObject as usual.
+    //! \param  [in] gmmClientContext
+    //!         GMM client context of the device
+    //! \param  [in] gmmParams
+    //!         GMM resource create params
+    //! \return GMM_RESOURCE_INFO*
+    //!         GMM resource info, nullptr if failed
+    //!
+    static GMM_RESOURCE_INFO *CreateResInfoObject(GMM_CLIENT_CONTEXT *gmmClientContext, GMM_RESCREATE_PARAMS *gmmParams);
+
+    //!
+    //! \brief  Get statistics of layout cache of GMM client context
+    //! \param  [in] gmmClientContext
+    //!         GMM client context of the device
+    //! \param  [out] stats
+    //!         Statistics
+    //! \return bool
+    //!         true if cache is registered for the context
+    //!
+    static bool GetStatistics(GMM_CLIENT_CONTEXT *gmmClientContext, Statistics &stats);
+
+    GmmLayoutCache(GMM_CLIENT_CONTEXT *gmmClientContext, bool validate);
+
+    virtual ~GmmLayoutCache();
+
+protected:
+    //!
+    //! \brief  Key of cache, the create params byte by byte
+    //! \details Byte compare never matches two params which differ in any
+    //!          field, so unknown or future fields can't produce a wrong hit.
+    //!
+    struct Key
+    {
+        GMM_RESCREATE_PARAMS params;
+
+        bool operator<(const Key &other) const
+        {
+            return memcmp(&params, &other.params, sizeof(params)) < 0;
+        }
+    };
+
+    static bool IsCacheable(const GMM_RESCREATE_PARAMS &gmmParams);
+    static bool IsSameLayout(GMM_RESOURCE_INFO *cached, GMM_RESOURCE_INFO *fresh);
+
+    GMM_CLIENT_CONTEXT                    *m_gmmClientContext = nullptr;
+    bool                                   m_validate         = false;
+    std::map<Key, GMM_RESOURCE_INFO *>     m_entries;
+    Statistics                             m_stats;
+
+    static std::mutex                                       m_mutex;   //!< Protects all caches and their content
+    static std::map<GMM_CLIENT_CONTEXT *, GmmLayoutCache *> m_caches;
+
+    static const uint32_t m_maxEntryCount = 512;
+
+MEDIA_CLASS_DEFINE_END(GmmLayoutCache)
+};
+
+#endif  // __MOS_GMM_LAYOUT_CACHE_H__
@@ -30,6 +30,7 @@
 #include "mos_graphicsresource_specific_next.h"
 #include "mos_context_specific_next.h"
 #include "memory_policy_manager.h"
+#include "mos_gmm_layout_cache.h"
 
 GraphicsResourceSpecificNext::GraphicsResourceSpecificNext()
 {
@@ -185,8 +186,8 @@ MOS_STATUS GraphicsResourceSpecificNext::Allocate(OsContextNext* osContextPtr, C
         gmmParams.Flags.Info.Linear     = true;
         gmmParams.Flags.Info.Cacheable  = true;
         gmmParams.NoGfxMemory           = true;
-        GMM_RESOURCE_INFO *tmpGmmResInfoPtr = pOsContextSpecific
-                ->GetGmmClientContext()->CreateResInfoObject(&gmmParams);
+        GMM_RESOURCE_INFO *tmpGmmResInfoPtr = GmmLayoutCache::CreateResInfoObject(
+                pOsContextSpecific->GetGmmClientContext(), &gmmParams);
         if (tmpGmmResInfoPtr == nullptr)
         {
             MOS_OS_ASSERTMESSAGE("Create GmmResInfo failed");
@@ -206,7 +207,7 @@ MOS_STATUS GraphicsResourceSpecificNext::Allocate(OsContextNext* osContextPtr, C
         gmmParams.Flags.Info.LocalOnly = MEDIA_IS_SKU(pOsContextSpecific->GetSkuTable(), FtrLocalMemory);
     }
 
-    GMM_RESOURCE_INFO*  gmmResourceInfoPtr = pOsContextSpecific->GetGmmClientContext()->CreateResInfoObject(&gmmParams);
+    GMM_RESOURCE_INFO*  gmmResourceInfoPtr = GmmLayoutCache::CreateResInfoObject(pOsContextSpecific->GetGmmClientContext(), &gmmParams);
 
     if (gmmResourceInfoPtr == nullptr)
     {
@@ -337,33 +338,37 @@ MOS_STATUS GraphicsResourceSpecificNext::Allocate(OsContextNext* osContextPtr, C
 
         MOS_OS_VERBOSEMESSAGE("Alloc %7d bytes (%d x %d resource), tile encoding %d.", bufSize, params.m_width, bufHeight, m_tileModeGMM);
 
-        struct {
-            uint32_t m_handle;
-            uint32_t m_resFormat;
-            uint32_t m_baseWidth;
-            uint32_t m_baseHeight;
-            uint32_t m_pitch;
-            uint32_t m_size;
-            uint32_t m_resTileType;
-            GMM_RESOURCE_FLAG m_resFlag;
-            uint32_t          m_reserve;
-        } eventData;
-
-        eventData.m_handle       = boPtr->handle;
-        eventData.m_baseWidth    = m_width;
-        eventData.m_baseHeight   = m_height;
-        eventData.m_pitch        = m_pitch;
-        eventData.m_size         = m_size;
-        eventData.m_resFormat    = m_format;
-        eventData.m_resTileType  = m_tileType;
-        eventData.m_resFlag      = gmmResourceInfoPtr->GetResFlags();
-        eventData.m_reserve      = 0;
-        MOS_TraceEventExt(EVENT_RESOURCE_ALLOCATE,
-            EVENT_TYPE_INFO,
-            &eventData,
-            sizeof(eventData),
-            params.m_name.c_str(),
-            params.m_name.size() + 1);
+        // GetResFlags and payload fill are skipped when the event is filtered out.
+        if (MOS_TraceEventEnabled(EVENT_RESOURCE_ALLOCATE))
+        {
+            struct {
+                uint32_t m_handle;
+                uint32_t m_resFormat;
+                uint32_t m_baseWidth;
+                uint32_t m_baseHeight;
+                uint32_t m_pitch;
+                uint32_t m_size;
+                uint32_t m_resTileType;
+                GMM_RESOURCE_FLAG m_resFlag;
+                uint32_t          m_reserve;
+            } eventData;
+
+            eventData.m_handle       = boPtr->handle;
+            eventData.m_baseWidth    = m_width;
+            eventData.m_baseHeight   = m_height;
+            eventData.m_pitch        = m_pitch;
+            eventData.m_size         = m_size;
+            eventData.m_resFormat    = m_format;
+            eventData.m_resTileType  = m_tileType;
+            eventData.m_resFlag      = gmmResourceInfoPtr->GetResFlags();
+            eventData.m_reserve      = 0;
+            MOS_TraceEventExt(EVENT_RESOURCE_ALLOCATE,
+                EVENT_TYPE_INFO,
+                &eventData,
+                sizeof(eventData),
+                params.m_name.c_str(),
+                params.m_name.size() + 1);
+        }
     }
     else
     {
@@ -754,7 +759,7 @@ MOS_STATUS GraphicsResourceSpecificNext::AllocateExternalResource(
     gmmParams.Flags.Info.LocalOnly = MEDIA_IS_SKU(&perStreamParameters->m_skuTable, FtrLocalMemory);
 
     MOS_OS_CHK_NULL_RETURN(perStreamParameters->pGmmClientContext);
-    resource->pGmmResInfo = gmmResourceInfo = perStreamParameters->pGmmClientContext->CreateResInfoObject(&gmmParams);
+    resource->pGmmResInfo = gmmResourceInfo = GmmLayoutCache::CreateResInfoObject(perStreamParameters->pGmmClientContext, &gmmParams);
 
     MOS_OS_CHK_NULL_RETURN(gmmResourceInfo);
 
@@ -52,6 +52,57 @@ MOS_STATUS MosUserSetting::InitMosUserSettingSpecific(MediaUserSettingSharedPtr
         0,
         true); //"Enable VM Bind."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Encode Coded Buffer CPU Cacheable",
+        MediaUserSetting::Group::Device,
+        0,
+        false); //"Allocate coded buffers in cacheable system memory for CPU readout."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Userptr Slice Data",
+        MediaUserSetting::Group::Device,
+        0,
+        false); //"Decode page aligned slice data from application memory in place, application keeps it unchanged until decode completes."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Disable GMM Layout Cache",
+        MediaUserSetting::Group::Device,
+        0,
+        false); //"Compute every GMM resource layout instead of copying cached ones."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Map Prefault Min Size KB",
+        MediaUserSetting::Group::Device,
+        0,
+        false); //"Prefault new CPU mappings of buffers at least this size at first lock, 0 disables prefault."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "NUMA Local Allocation",
+        MediaUserSetting::Group::Device,
+        1,
+        false); //"Prefer NUMA node of the device for large CPU allocations, served from mappings of their own."
+
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "NUMA Thread Affinity",
+        MediaUserSetting::Group::Device,
+        0,
+        false); //"Run driver created threads on CPUs of NUMA node of the device."
+
+#if (_DEBUG || _RELEASE_INTERNAL)
+    DeclareUserSettingKeyForDebug(
+        userSettingPtr,
+        "GMM Layout Cache Validate",
+        MediaUserSetting::Group::Device,
+        0,
+        false); //"Compare cached GMM resource layouts with freshly computed ones."
+#endif
+
     DeclareUserSettingKey(
         userSettingPtr,
         "INTEL MEDIA ALLOC MODE",
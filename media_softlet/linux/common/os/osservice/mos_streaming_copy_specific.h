@@ -0,0 +1,295 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_streaming_copy_specific.h
+//! \brief    CPU copy routines for reading write combined memory
+//! \details  Ordinary loads from a write combined mapping are uncached, each
+//!           one goes to memory. SSE4.1 movntdqa and its AVX2 form fetch a
+//!           whole 64 bytes line into a streaming load buffer, so following
+//!           loads of the same line are served from it. Copies larger than
+//!           ntStoreThreshold also use non temporal stores, so the destination
+//!           which is usually consumed later by application does not flush
+//!           the caches. Code path is selected at runtime by CPU features,
+//!           no compiler flag is needed by includers.
+//!
+#ifndef __MOS_STREAMING_COPY_SPECIFIC_H__
+#define __MOS_STREAMING_COPY_SPECIFIC_H__
+
+#include <stdint.h>
+#include <string.h>
+#include "media_class_trace.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MOS_STREAMING_COPY_X86 1
+#include <immintrin.h>
+#endif
+
+class MosStreamingCopy
+{
+public:
+    enum Level
+    {
+        levelNone = 0,   //!< memcpy
+        levelSse41,      //!< 16 bytes streaming loads
+        levelAvx2,       //!< 32 bytes streaming loads
+    };
+
+    static const size_t ntStoreThreshold = 0x100000;  //!< Copies from 1MB on use non temporal stores
+
+    //!
+    //! \brief  Get best level supported by current CPU, detected once per process
+    //!
+    static Level GetCpuLevel()
+    {
+        static const Level level = DetectCpuLevel();
+        return level;
+    }
+
+    //!
+    //! \brief  Copy size bytes from src to dst
+    //! \param  [in] level
+    //!         Code path, must not be higher than GetCpuLevel()
+    //! \param  [in] ntStore
+    //!         Write dst with non temporal stores
+    //!
+    static void Copy(void *dst, const void *src, size_t size, Level level, bool ntStore)
+    {
+        Begin(level);
+        CopyRow((uint8_t *)dst, (const uint8_t *)src, size, level, ntStore);
+        End(level, ntStore);
+    }
+
+    static void Copy(void *dst, const void *src, size_t size)
+    {
+        Copy(dst, src, size, GetCpuLevel(), size >= ntStoreThreshold);
+    }
+
+    //!
+    //! \brief  Copy widthInBytes of each of height rows from src to dst
+    //! \param  [in] level
+    //!         Code path, must not be higher than GetCpuLevel()
+    //! \param  [in] ntStore
+    //!         Write dst with non temporal stores
+    //!
+    static void Copy2D(
+        void       *dst,
+        size_t      dstPitch,
+        const void *src,
+        size_t      srcPitch,
+        size_t      widthInBytes,
+        size_t      height,
+        Level       level,
+        bool        ntStore)
+    {
+        if (dstPitch == widthInBytes && srcPitch == widthInBytes)
+        {
+            Copy(dst, src, widthInBytes * height, level, ntStore);
+            return;
+        }
+
+        Begin(level);
+        uint8_t       *dstRow = (uint8_t *)dst;
+        const uint8_t *srcRow = (const uint8_t *)src;
+        for (size_t y = 0; y < height; y++)
+        {
+            CopyRow(dstRow, srcRow, widthInBytes, level, ntStore);
+            dstRow += dstPitch;
+            srcRow += srcPitch;
+        }
+        End(level, ntStore);
+    }
+
+    static void Copy2D(
+        void       *dst,
+        size_t      dstPitch,
+        const void *src,
+        size_t      srcPitch,
+        size_t      widthInBytes,
+        size_t      height)
+    {
+        Copy2D(dst, dstPitch, src, srcPitch, widthInBytes, height,
+            GetCpuLevel(), widthInBytes * height >= ntStoreThreshold);
+    }
+
+protected:
+    static Level DetectCpuLevel()
+    {
+#if MOS_STREAMING_COPY_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return levelAvx2;
+        }
+        if (__builtin_cpu_supports("sse4.1"))
+        {
+            return levelSse41;
+        }
+#endif
+        return levelNone;
+    }
+
+    static void CopyRow(uint8_t *dst, const uint8_t *src, size_t size, Level level, bool ntStore)
+    {
+#if MOS_STREAMING_COPY_X86
+        if (level == levelAvx2)
+        {
+            CopyRowAvx2(dst, src, size, ntStore);
+            return;
+        }
+        if (level == levelSse41)
+        {
+            CopyRowSse41(dst, src, size, ntStore);
+            return;
+        }
+#endif
+        memcpy(dst, src, size);
+    }
+
+#if MOS_STREAMING_COPY_X86
+    static void Begin(Level level)
+    {
+        if (level != levelNone)
+        {
+            // Streaming loads are weakly ordered, make sure earlier writes
+            // (such as GPU completion observed through a fence) are visible.
+            MemoryFence();
+        }
+    }
+
+    static void End(Level level, bool ntStore)
+    {
+        if (level != levelNone && ntStore)
+        {
+            // Non temporal stores are weakly ordered as well, flush them
+            // before destination is handed over.
+            StoreFence();
+        }
+    }
+
+    __attribute__((target("sse2"))) static void MemoryFence()
+    {
+        _mm_mfence();
+    }
+
+    __attribute__((target("sse2"))) static void StoreFence()
+    {
+        _mm_sfence();
+    }
+
+    __attribute__((target("sse4.1"))) static void CopyRowSse41(uint8_t *dst, const uint8_t *src, size_t size, bool ntStore)
+    {
+        size_t head = (16 - ((uintptr_t)src & 15)) & 15;
+        head        = head < size ? head : size;
+        memcpy(dst, src, head);
+        dst  += head;
+        src  += head;
+        size -= head;
+
+        if (ntStore && ((uintptr_t)dst & 15) == 0)
+        {
+            for (; size >= 64; size -= 64, src += 64, dst += 64)
+            {
+                __m128i x0 = _mm_stream_load_si128((__m128i *)src);
+                __m128i x1 = _mm_stream_load_si128((__m128i *)(src + 16));
+                __m128i x2 = _mm_stream_load_si128((__m128i *)(src + 32));
+                __m128i x3 = _mm_stream_load_si128((__m128i *)(src + 48));
+                _mm_stream_si128((__m128i *)dst, x0);
+                _mm_stream_si128((__m128i *)(dst + 16), x1);
+                _mm_stream_si128((__m128i *)(dst + 32), x2);
+                _mm_stream_si128((__m128i *)(dst + 48), x3);
+            }
+        }
+        else
+        {
+            for (; size >= 64; size -= 64, src += 64, dst += 64)
+            {
+                __m128i x0 = _mm_stream_load_si128((__m128i *)src);
+                __m128i x1 = _mm_stream_load_si128((__m128i *)(src + 16));
+                __m128i x2 = _mm_stream_load_si128((__m128i *)(src + 32));
+                __m128i x3 = _mm_stream_load_si128((__m128i *)(src + 48));
+                _mm_storeu_si128((__m128i *)dst, x0);
+                _mm_storeu_si128((__m128i *)(dst + 16), x1);
+                _mm_storeu_si128((__m128i *)(dst + 32), x2);
+                _mm_storeu_si128((__m128i *)(dst + 48), x3);
+            }
+        }
+
+        for (; size >= 16; size -= 16, src += 16, dst += 16)
+        {
+            _mm_storeu_si128((__m128i *)dst, _mm_stream_load_si128((__m128i *)src));
+        }
+        memcpy(dst, src, size);
+    }
+
+    __attribute__((target("avx2"))) static void CopyRowAvx2(uint8_t *dst, const uint8_t *src, size_t size, bool ntStore)
+    {
+        size_t head = (32 - ((uintptr_t)src & 31)) & 31;
+        head        = head < size ? head : size;
+        memcpy(dst, src, head);
+        dst  += head;
+        src  += head;
+        size -= head;
+
+        if (ntStore && ((uintptr_t)dst & 31) == 0)
+        {
+            for (; size >= 128; size -= 128, src += 128, dst += 128)
+            {
+                __m256i y0 = _mm256_stream_load_si256((__m256i *)src);
+                __m256i y1 = _mm256_stream_load_si256((__m256i *)(src + 32));
+                __m256i y2 = _mm256_stream_load_si256((__m256i *)(src + 64));
+                __m256i y3 = _mm256_stream_load_si256((__m256i *)(src + 96));
+                _mm256_stream_si256((__m256i *)dst, y0);
+                _mm256_stream_si256((__m256i *)(dst + 32), y1);
+                _mm256_stream_si256((__m256i *)(dst + 64), y2);
+                _mm256_stream_si256((__m256i *)(dst + 96), y3);
+            }
+        }
+        else
+        {
+            for (; size >= 128; size -= 128, src += 128, dst += 128)
+            {
+                __m256i y0 = _mm256_stream_load_si256((__m256i *)src);
+                __m256i y1 = _mm256_stream_load_si256((__m256i *)(src + 32));
+                __m256i y2 = _mm256_stream_load_si256((__m256i *)(src + 64));
+                __m256i y3 = _mm256_stream_load_si256((__m256i *)(src + 96));
+                _mm256_storeu_si256((__m256i *)dst, y0);
+                _mm256_storeu_si256((__m256i *)(dst + 32), y1);
+                _mm256_storeu_si256((__m256i *)(dst + 64), y2);
+                _mm256_storeu_si256((__m256i *)(dst + 96), y3);
+            }
+        }
+
+        for (; size >= 32; size -= 32, src += 32, dst += 32)
+        {
+            _mm256_storeu_si256((__m256i *)dst, _mm256_stream_load_si256((__m256i *)src));
+        }
+        memcpy(dst, src, size);
+    }
+#else
+    static void Begin(Level level) {}
+    static void End(Level level, bool ntStore) {}
+#endif
+
+MEDIA_CLASS_DEFINE_END(MosStreamingCopy)
+};
+
+#endif  // __MOS_STREAMING_COPY_SPECIFIC_H__
@@ -0,0 +1,282 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_trace_ring_specific.cpp
+//! \brief    Implements shared memory trace ring
+//!
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include "mos_trace_ring_specific.h"
+
+#define MT_RING_RECORD_ALIGN    16
+#define MT_RING_MIN_SLOT_SIZE   0x1000
+#define MT_RING_MAX_SLOT_SIZE   0x4000000
+
+std::atomic<MtRingFileHeader *> MosTraceRing::m_header(nullptr);
+std::atomic<uint32_t>           MosTraceRing::m_writerCount(0);
+uint64_t                        MosTraceRing::m_mapSize = 0;
+uint32_t                        MosTraceRing::m_generation = 0;
+char                            MosTraceRing::m_path[64] = {};
+
+//!
+//! \brief Slot claimed by current thread, given back on thread exit
+//!
+struct MosTraceRing::ThreadSlot
+{
+    MtRingFileHeader *header     = nullptr;  //!< Ring which the slot belongs to
+    uint32_t          generation = 0;        //!< Generation of that ring
+    MtRingSlotHeader *slot       = nullptr;
+    uint32_t          index      = 0;
+    uint32_t          tid        = 0;
+
+    bool BelongsTo(MtRingFileHeader *ring) const
+    {
+        // A ring reopened at the same address has a new generation.
+        return ring != nullptr && ring == header && ring->generation == generation;
+    }
+
+    ~ThreadSlot()
+    {
+        if (slot == nullptr)
+        {
+            return;
+        }
+        // Counted as writer, so the ring can not be unmapped while the slot is given back.
+        m_writerCount.fetch_add(1);
+        if (BelongsTo(m_header.load()))
+        {
+            slot->owner.store(0, std::memory_order_release);
+        }
+        m_writerCount.fetch_sub(1, std::memory_order_release);
+    }
+};
+
+bool MosTraceRing::Open(uint32_t slotSizeInKB)
+{
+    if (m_header.load() != nullptr)
+    {
+        return true;
+    }
+
+    uint64_t slotSize = MT_RING_MIN_SLOT_SIZE;
+    while (slotSize < (uint64_t)slotSizeInKB * 1024 && slotSize < MT_RING_MAX_SLOT_SIZE)
+    {
+        slotSize <<= 1;
+    }
+
+    uint64_t dataOffset = MT_RING_HEADER_SIZE + MT_RING_SLOT_COUNT * sizeof(MtRingSlotHeader);
+    dataOffset          = (dataOffset + MT_RING_HEADER_SIZE - 1) & ~((uint64_t)MT_RING_HEADER_SIZE - 1);
+    uint64_t mapSize    = dataOffset + MT_RING_SLOT_COUNT * slotSize;
+
+    static bool exitHandlerSet = false;
+    if (!exitHandlerSet)
+    {
+        exitHandlerSet = (atexit(RemoveFile) == 0);
+    }
+
+    snprintf(m_path, sizeof(m_path), "%s.%d", MT_RING_PATH_PREFIX, (int)getpid());
+
+    // Path is predictable, never follow a link or reuse a file planted there.
+    // A leftover of an earlier process with the same pid is removed first,
+    // unlink drops a link itself rather than its target.
+    int fd = open(m_path, O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    if (fd < 0 && errno == EEXIST && unlink(m_path) == 0)
+    {
+        fd = open(m_path, O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    }
+    if (fd < 0)
+    {
+        m_path[0] = '\0';
+        return false;
+    }
+    if (ftruncate(fd, mapSize) != 0)
+    {
+        close(fd);
+        RemoveFile();
+        return false;
+    }
+    void *addr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);  // map addr still valid after close
+    if (addr == MAP_FAILED)
+    {
+        RemoveFile();
+        return false;
+    }
+
+    // File is zero filled by ftruncate, which is the initial state of all atomics.
+    MtRingFileHeader *header = (MtRingFileHeader *)addr;
+    header->version    = MT_RING_VERSION;
+    header->pid        = (uint32_t)getpid();
+    header->slotCount  = MT_RING_SLOT_COUNT;
+    header->slotSize   = (uint32_t)slotSize;
+    header->headerSize = MT_RING_HEADER_SIZE;
+    header->dataOffset = dataOffset;
+    header->generation = ++m_generation;
+    // Reader checks magic before anything else, publish it last.
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic      = MT_RING_MAGIC;
+
+    m_mapSize = mapSize;
+    m_header.store(header);
+
+    return true;
+}
+
+void MosTraceRing::Close()
+{
+    MtRingFileHeader *header = m_header.exchange(nullptr);
+    if (header == nullptr)
+    {
+        return;
+    }
+
+    // Writers which loaded the header before it was cleared may still be writing to it.
+    while (m_writerCount.load() != 0)
+    {
+        sched_yield();
+    }
+
+    munmap(header, m_mapSize);
+    m_mapSize = 0;
+    RemoveFile();
+}
+
+void MosTraceRing::RemoveFile()
+{
+    // Also run at process exit, so tmpfs is not filled up with rings of
+    // processes which never closed the trace.
+    if (m_path[0] != '\0')
+    {
+        unlink(m_path);
+        m_path[0] = '\0';
+    }
+}
+
+MtRingSlotHeader *MosTraceRing::AcquireSlot(MtRingFileHeader *header, uint32_t &slotIndex, uint32_t &tid)
+{
+    static thread_local ThreadSlot threadSlot;
+
+    // Claim a slot on first event of this thread, after the ring is reopened,
+    // or when no slot was free last time.
+    if (!threadSlot.BelongsTo(header) || threadSlot.slot == nullptr)
+    {
+        threadSlot.header     = header;
+        threadSlot.generation = header->generation;
+        threadSlot.slot       = nullptr;
+        threadSlot.tid        = (uint32_t)syscall(SYS_gettid);
+
+        MtRingSlotHeader *slots = (MtRingSlotHeader *)((uint8_t *)header + header->headerSize);
+        for (uint32_t i = 0; i < header->slotCount; i++)
+        {
+            uint32_t expected = 0;
+            if (slots[i].owner.compare_exchange_strong(expected, threadSlot.tid, std::memory_order_acq_rel))
+            {
+                threadSlot.slot  = &slots[i];
+                threadSlot.index = i;
+                break;
+            }
+        }
+    }
+
+    slotIndex = threadSlot.index;
+    tid       = threadSlot.tid;
+    return threadSlot.slot;
+}
+
+void MosTraceRing::Write(const void *data, uint32_t size)
+{
+    if (data == nullptr || m_header.load(std::memory_order_relaxed) == nullptr)
+    {
+        return;
+    }
+
+    // Count in before loading the header, so Close either sees this writer or this writer sees no header.
+    m_writerCount.fetch_add(1);
+    MtRingFileHeader *header = m_header.load();
+    if (header != nullptr)
+    {
+        WriteRecord(header, data, size);
+    }
+    m_writerCount.fetch_sub(1, std::memory_order_release);
+}
+
+void MosTraceRing::WriteRecord(MtRingFileHeader *header, const void *data, uint32_t size)
+{
+    uint32_t          slotIndex = 0;
+    uint32_t          tid       = 0;
+    MtRingSlotHeader *slot      = AcquireSlot(header, slotIndex, tid);
+    if (slot == nullptr)
+    {
+        header->dropCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint32_t slotSize   = header->slotSize;
+    uint32_t recordSize = (sizeof(MtRingRecordHeader) + size + MT_RING_RECORD_ALIGN - 1) & ~(MT_RING_RECORD_ALIGN - 1);
+    if (recordSize > slotSize / 2)
+    {
+        slot->dropCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Single producer per slot, only readPos is shared with consumer.
+    uint64_t writePos = slot->writePos.load(std::memory_order_relaxed);
+    uint64_t readPos  = slot->readPos.load(std::memory_order_acquire);
+    uint32_t offset   = (uint32_t)(writePos & (slotSize - 1));
+    uint32_t padding  = (slotSize - offset < recordSize) ? slotSize - offset : 0;
+
+    if (writePos + padding + recordSize - readPos > slotSize)
+    {
+        slot->dropCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint8_t *ring = (uint8_t *)header + header->dataOffset + (uint64_t)slotIndex * slotSize;
+    if (padding)
+    {
+        MtRingRecordHeader *pad = (MtRingRecordHeader *)(ring + offset);
+        pad->size      = padding;
+        pad->tid       = 0;
+        pad->timestamp = 0;
+        offset         = 0;
+    }
+
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    MtRingRecordHeader *record = (MtRingRecordHeader *)(ring + offset);
+    record->size      = recordSize;
+    record->tid       = tid;
+    record->timestamp = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+    memcpy(record + 1, data, size);
+
+    slot->writePos.store(writePos + padding + recordSize, std::memory_order_release);
+}
@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_trace_ring_specific.h
+//! \brief    Shared memory trace ring, an alternative output of IMTE trace events
+//! \details  When GFX_MEDIA_TRACE_RING is set to a per thread ring size in KB,
+//!           trace events are written into /dev/shm/GFX_MEDIA_TRACE_RING.<pid>
+//!           instead of one write() to trace_marker_raw per event.
+//!
+//!           File layout (all fields little endian):
+//!             MtRingFileHeader                      at offset 0, one page
+//!             MtRingSlotHeader[slotCount]           at headerSize
+//!             ring data[slotCount][slotSize]        at dataOffset
+//!
+//!           Each thread owns one slot, so the ring is single producer and
+//!           single consumer. Producer advances writePos after the record is
+//!           complete, consumer advances readPos after the record is decoded,
+//!           both are byte counts which only grow, offset in ring is pos % slotSize.
+//!
+//!           Record layout, 16 bytes aligned:
+//!             uint32_t size;       // record size in bytes including this header
+//!             uint32_t tid;        // producer thread id
+//!             uint64_t timestamp;  // CLOCK_MONOTONIC in ns
+//!             uint8_t  payload[];  // IMTE event exactly as written to trace_marker_raw
+//!           A record never wraps. If it does not fit in the rest of ring, a
+//!           padding record with tid 0 and no payload fills up the rest.
+//!
+//!           If consumer falls behind, new records are dropped and counted in
+//!           dropCount of the slot, or of the file header if no slot is free.
+//!           The file is created 0600 and removed on close and at process exit,
+//!           a reader attached before that keeps its mapping. The reader is
+//!           Tools/MediaDriverTools/MediaTraceRing/read_trace_ring.py.
+//!
+#ifndef __MOS_TRACE_RING_SPECIFIC_H__
+#define __MOS_TRACE_RING_SPECIFIC_H__
+
+#include <atomic>
+#include <stdint.h>
+#include "media_class_trace.h"
+
+#define MT_RING_MAGIC           0x52544D49  // IMTR
+#define MT_RING_VERSION         1
+#define MT_RING_PATH_PREFIX     "/dev/shm/GFX_MEDIA_TRACE_RING"
+#define MT_RING_SLOT_COUNT      64
+#define MT_RING_HEADER_SIZE     4096
+
+struct MtRingFileHeader
+{
+    uint32_t              magic;
+    uint32_t              version;
+    uint32_t              pid;
+    uint32_t              slotCount;
+    uint32_t              slotSize;       //!< Bytes of ring data per slot, power of 2
+    uint32_t              headerSize;     //!< Offset of slot headers
+    uint64_t              dataOffset;     //!< Offset of ring data of slot 0
+    std::atomic<uint64_t> dropCount;      //!< Records dropped as no slot is free
+    uint32_t              generation;     //!< Bumped by each Open, tells a remap at the same address apart
+    uint32_t              reserved;
+};
+
+struct alignas(64) MtRingSlotHeader
+{
+    std::atomic<uint32_t> owner;          //!< Thread id of current producer, 0 if free
+    uint32_t              reserved;
+    std::atomic<uint64_t> writePos;
+    std::atomic<uint64_t> readPos;
+    std::atomic<uint64_t> dropCount;      //!< Records dropped as ring is full
+};
+
+struct MtRingRecordHeader
+{
+    uint32_t size;
+    uint32_t tid;
+    uint64_t timestamp;
+};
+
+class MosTraceRing
+{
+public:
+    //!
+    //! \brief  Create shared memory trace ring file for current process
+    //! \param  [in] slotSizeInKB
+    //!         Ring size of each thread in KB, rounded up to power of 2
+    //! \return bool
+    //!         true if ring is ready
+    //!
+    static bool Open(uint32_t slotSizeInKB);
+
+    //!
+    //! \brief  Unmap and remove trace ring file
+    //! \details Waits for threads still inside Write before unmapping.
+    //!
+    static void Close();
+
+    //!
+    //! \brief  Check if trace ring is in use
+    //!
+    static bool IsOpened()
+    {
+        return m_header.load(std::memory_order_relaxed) != nullptr;
+    }
+
+    //!
+    //! \brief  Append one IMTE event to ring of calling thread
+    //! \param  [in] data
+    //!         Event data
+    //! \param  [in] size
+    //!         Event size in bytes
+    //!
+    static void Write(const void *data, uint32_t size);
+
+protected:
+    struct ThreadSlot;
+
+    static MtRingSlotHeader *AcquireSlot(MtRingFileHeader *header, uint32_t &slotIndex, uint32_t &tid);
+
+    static void WriteRecord(MtRingFileHeader *header, const void *data, uint32_t size);
+
+    static void RemoveFile();
+
+    static std::atomic<MtRingFileHeader *> m_header;
+    static std::atomic<uint32_t>           m_writerCount;  //!< Threads which may still use m_header
+    static uint64_t                        m_mapSize;
+    static uint32_t                        m_generation;   //!< Generation of last opened ring
+    static char                            m_path[64];
+
+MEDIA_CLASS_DEFINE_END(MosTraceRing)
+};
+
+#endif  // __MOS_TRACE_RING_SPECIFIC_H__
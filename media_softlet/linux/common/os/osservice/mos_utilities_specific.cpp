@@ -41,8 +41,15 @@
 #include <sys/types.h>
 #include <sys/sem.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sched.h>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include "mos_user_setting.h"
 #include "mos_utilities_specific.h"
+#include "mos_trace_ring_specific.h"
+#include "mos_streaming_copy_specific.h"
 #include "mos_utilities.h"
 #include "mos_util_debug.h"
 #include "inttypes.h"
@@ -107,6 +114,33 @@ MosMutex          MosUtilitiesSpecificNext::m_userSettingMutex;
 #define TRACE_EVENT_HEADER_SIZE        (sizeof(uint32_t)*3)
 #define TRACE_EVENT_MAX_DATA_SIZE      (TRACE_EVENT_MAX_SIZE - TRACE_EVENT_HEADER_SIZE - sizeof(uint32_t)) // in 4bytes aligned size
 
+//!
+//! \brief Check if trace event output is ready, either shared memory trace ring or ftrace raw marker
+//!
+static inline bool MosTraceOutputReady()
+{
+    return MosTraceRing::IsOpened() || MosUtilitiesSpecificNext::m_mosTraceFd >= 0;
+}
+
+//!
+//! \brief Output one trace event
+//!
+static inline void MosTraceOutput(const void *buf, uint32_t size)
+{
+    if (MosTraceRing::IsOpened())
+    {
+        MosTraceRing::Write(buf, size);
+    }
+    else
+    {
+        // Trace is best effort, an event which fails to write is dropped.
+        if (write(MosUtilitiesSpecificNext::m_mosTraceFd, buf, size) < 0)
+        {
+            return;
+        }
+    }
+}
+
 //!
 //! \brief for int64_t/uint64_t format print warning
 //!
@@ -210,6 +244,50 @@ MOS_STATUS MosUtilities::MosSecureMemcpy(void  *pDestination, size_t dstLength,
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS MosUtilities::MosStreamingMemcpy(void *pDestination, size_t dstLength, PCVOID pSource, size_t srcLength)
+{
+    if ( (pDestination == nullptr) || (pSource == nullptr) )
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    if ( dstLength < srcLength )
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    if(pDestination != pSource)
+    {
+        MosStreamingCopy::Copy(pDestination, pSource, srcLength);
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS MosUtilities::MosStreamingMemcpy2D(
+    void        *pDestination,
+    uint32_t    dstPitch,
+    PCVOID      pSource,
+    uint32_t    srcPitch,
+    uint32_t    widthInBytes,
+    uint32_t    height)
+{
+    if ( (pDestination == nullptr) || (pSource == nullptr) )
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    if ( (widthInBytes > dstPitch) || (widthInBytes > srcPitch) )
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    if(pDestination != pSource)
+    {
+        MosStreamingCopy::Copy2D(pDestination, dstPitch, pSource, srcPitch, widthInBytes, height);
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS MosUtilities::MosSecureFileOpen(
     FILE       **ppFile,
     const char *filename,
@@ -2180,6 +2258,297 @@ MOS_STATUS MosUtilities::MosUserFeatureParsePath(
     return MOS_STATUS_SUCCESS;
 }
 
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+#define MOS_NUMA_NODE_UNSET         (-2)
+#define MOS_NUMA_MAX_NODE           1024
+#define MOS_NUMA_PLACE_MIN_SIZE     0x40000  // 256KB, smaller allocations mostly come from heap pages already faulted
+
+static std::atomic<int32_t> s_mosNumaNode(MOS_NUMA_NODE_UNSET);
+static std::atomic<bool>    s_mosNumaLocalAlloc(false);
+static std::atomic<bool>    s_mosNumaThreadAffinity(false);
+
+// Mappings of MosAllocMemoryOnNumaNode, start address to mapped size. Never destroyed,
+// so memory freed by static destructors at process exit still finds its mapping.
+static std::atomic<uint32_t>                    s_mosNumaMappingCount(0);
+static std::mutex                              *s_mosNumaMappingMutex = new std::mutex;
+static std::unordered_map<uintptr_t, size_t>   *s_mosNumaMappings     = new std::unordered_map<uintptr_t, size_t>;
+
+//!
+//! \brief    Get CPUs of the NUMA node set by MosSetNumaNode
+//! \param    [out] cpuSet
+//!           CPUs of the node
+//! \return   bool
+//!           true if thread affinity is enabled and the node has CPUs
+//!
+static bool MosGetNumaCpuSet(cpu_set_t &cpuSet)
+{
+    int32_t node = s_mosNumaNode.load(std::memory_order_relaxed);
+    if (node < 0 || !s_mosNumaThreadAffinity.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    char path[64] = {};
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    FILE *fp = fopen(path, "r");
+    if (fp == nullptr)
+    {
+        return false;
+    }
+
+    // cpulist is a comma separated list of ranges, e.g. "0-15,32-47".
+    CPU_ZERO(&cpuSet);
+    int  cpuCount = 0;
+    int  first    = 0;
+    int  last     = 0;
+    char sep      = 0;
+    while (fscanf(fp, "%d", &first) == 1)
+    {
+        last = first;
+        sep  = (char)fgetc(fp);
+        if (sep == '-')
+        {
+            if (fscanf(fp, "%d", &last) != 1)
+            {
+                break;
+            }
+            sep = (char)fgetc(fp);
+        }
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+        {
+            CPU_SET(cpu, &cpuSet);
+            cpuCount++;
+        }
+        if (sep != ',')
+        {
+            break;
+        }
+    }
+    fclose(fp);
+
+    return cpuCount > 0;
+}
+
+//!
+//! \brief    Set NUMA memory policy of an address range or of calling thread
+//! \param    [in] ptr
+//!           Start of range, page aligned, nullptr for calling thread
+//! \param    [in] size
+//!           Size of range in bytes
+//! \param    [in] node
+//!           Preferred node
+//! \return   bool
+//!           true if success
+//!
+static bool MosSetNumaPolicy(void *ptr, size_t size, int32_t node)
+{
+    unsigned long nodeMask[MOS_NUMA_MAX_NODE / (8 * sizeof(unsigned long))] = {};
+    nodeMask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+
+    // Kernel drops the last bit of maxnode, pass one more than mask size as libnuma does.
+    long ret = (ptr == nullptr) ?
+        syscall(SYS_set_mempolicy, MPOL_PREFERRED, nodeMask, MOS_NUMA_MAX_NODE + 1) :
+        syscall(SYS_mbind, ptr, size, MPOL_PREFERRED, nodeMask, MOS_NUMA_MAX_NODE + 1, 0);
+
+    return ret == 0;
+}
+
+void MosUtilities::MosSetNumaNode(
+    int32_t                     node,
+    bool                        localAlloc,
+    bool                        threadAffinity)
+{
+    if (node >= MOS_NUMA_MAX_NODE - 1)
+    {
+        node = -1;
+    }
+
+    int32_t expected = MOS_NUMA_NODE_UNSET;
+    if (!s_mosNumaNode.compare_exchange_strong(expected, node))
+    {
+        if (expected != node && expected >= 0)
+        {
+            // Devices on different nodes in one process, no single node is local to all of them.
+            MOS_OS_NORMALMESSAGE("Devices on NUMA node %d and %d, NUMA placement disabled.", expected, node);
+            s_mosNumaNode.store(-1);
+        }
+        return;
+    }
+
+    if (node < 0)
+    {
+        return;
+    }
+
+    s_mosNumaLocalAlloc.store(localAlloc);
+    s_mosNumaThreadAffinity.store(threadAffinity);
+    MOS_OS_NORMALMESSAGE("Device on NUMA node %d, local allocation %d, thread affinity %d.", node, localAlloc, threadAffinity);
+}
+
+int32_t MosUtilities::MosGetNumaNode()
+{
+    int32_t node = s_mosNumaNode.load(std::memory_order_relaxed);
+    return node < 0 ? -1 : node;
+}
+
+void MosUtilities::MosBindThreadToNumaNode()
+{
+    cpu_set_t cpuSet;
+    if (!MosGetNumaCpuSet(cpuSet))
+    {
+        return;
+    }
+
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        MOS_OS_NORMALMESSAGE("Failed to bind thread to NUMA node, errno %d.", errno);
+        return;
+    }
+
+    // Pages first touched by this thread, including system memory of BOs, go to the node as well.
+    MosSetNumaPolicy(nullptr, 0, s_mosNumaNode.load(std::memory_order_relaxed));
+}
+
+void *MosUtilities::MosAllocMemoryOnNumaNode(
+    size_t                      size,
+    size_t                      alignment)
+{
+    if (size < MOS_NUMA_PLACE_MIN_SIZE || alignment > MOS_PAGE_SIZE ||
+        !s_mosNumaLocalAlloc.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    int32_t node = s_mosNumaNode.load(std::memory_order_relaxed);
+    if (node < 0)
+    {
+        return nullptr;
+    }
+
+    // A mapping of its own rather than heap pages, so the policy goes away with munmap on free.
+    size_t mapSize = MOS_ALIGN_CEIL(size, MOS_PAGE_SIZE);
+    void  *ptr     = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    if (!MosSetNumaPolicy(ptr, mapSize, node))
+    {
+        if (errno == ENOSYS)
+        {
+            // Kernel without NUMA support, stop trying.
+            s_mosNumaLocalAlloc.store(false);
+        }
+        munmap(ptr, mapSize);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(*s_mosNumaMappingMutex);
+    s_mosNumaMappings->emplace((uintptr_t)ptr, mapSize);
+    s_mosNumaMappingCount.fetch_add(1, std::memory_order_relaxed);
+
+    return ptr;
+}
+
+size_t MosUtilities::MosGetNumaMemorySize(
+    const void                  *ptr)
+{
+    // Mappings are page aligned, skip the lookup for the heap pointers which mostly are not.
+    if (((uintptr_t)ptr & (MOS_PAGE_SIZE - 1)) != 0 || ptr == nullptr ||
+        s_mosNumaMappingCount.load(std::memory_order_relaxed) == 0)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(*s_mosNumaMappingMutex);
+    auto it = s_mosNumaMappings->find((uintptr_t)ptr);
+    return (it == s_mosNumaMappings->end()) ? 0 : it->second;
+}
+
+bool MosUtilities::MosFreeMemoryOnNumaNode(
+    void                        *ptr)
+{
+    if (((uintptr_t)ptr & (MOS_PAGE_SIZE - 1)) != 0 || ptr == nullptr ||
+        s_mosNumaMappingCount.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    size_t mapSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(*s_mosNumaMappingMutex);
+        auto it = s_mosNumaMappings->find((uintptr_t)ptr);
+        if (it == s_mosNumaMappings->end())
+        {
+            return false;
+        }
+        mapSize = it->second;
+        s_mosNumaMappings->erase(it);
+        s_mosNumaMappingCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    munmap(ptr, mapSize);
+    return true;
+}
+
+void MosUtilities::MosReportNumaMemory()
+{
+#if MOS_MESSAGES_ENABLED
+    // Only worth the numa_maps walk when placement is turned on.
+    if (s_mosNumaNode.load(std::memory_order_relaxed) < 0 ||
+        (!s_mosNumaLocalAlloc.load(std::memory_order_relaxed) &&
+         !s_mosNumaThreadAffinity.load(std::memory_order_relaxed)))
+    {
+        return;
+    }
+
+    FILE *fp = fopen("/proc/self/numa_maps", "r");
+    if (fp == nullptr)
+    {
+        return;
+    }
+
+    const int32_t maxReportNode = 64;
+    uint64_t      nodeBytes[maxReportNode] = {};
+    char          line[1024];
+    while (fgets(line, sizeof(line), fp))
+    {
+        // Each mapping lists resident pages per node as "N<node>=<pages>", page size as "kernelpagesize_kB=<size>".
+        uint64_t pageSize = MOS_PAGE_SIZE;
+        char    *field    = strstr(line, "kernelpagesize_kB=");
+        if (field)
+        {
+            pageSize = strtoull(field + strlen("kernelpagesize_kB="), nullptr, 10) * 1024;
+        }
+
+        for (field = strstr(line, " N"); field; field = strstr(field + 2, " N"))
+        {
+            char *end  = nullptr;
+            long  node = strtol(field + 2, &end, 10);
+            if (end == field + 2 || *end != '=' || node < 0 || node >= maxReportNode)
+            {
+                continue;
+            }
+            nodeBytes[node] += strtoull(end + 1, nullptr, 10) * pageSize;
+        }
+    }
+    fclose(fp);
+
+    MOS_OS_NORMALMESSAGE("Device NUMA node %d, process resident memory per node:", MosGetNumaNode());
+    for (int32_t node = 0; node < maxReportNode; node++)
+    {
+        if (nodeBytes[node])
+        {
+            MOS_OS_NORMALMESSAGE("  node %d: %llu KB", node, (unsigned long long)(nodeBytes[node] / 1024));
+        }
+    }
+#endif
+}
+
 uint32_t MosUtilities::MosGetLogicalCoreNumber()
 {
     return sysconf(_SC_NPROCESSORS_CONF);
@@ -2190,13 +2559,28 @@ MOS_THREADHANDLE MosUtilities::MosCreateThread(
     void                        *ThreadData)
 {
     MOS_THREADHANDLE Thread;
+    pthread_attr_t   attr;
+    pthread_attr_t  *pAttr = nullptr;
+    cpu_set_t        cpuSet;
+
+    // New thread starts on CPUs of the device node, no need to wait for it to bind itself.
+    if (MosGetNumaCpuSet(cpuSet) && pthread_attr_init(&attr) == 0)
+    {
+        pAttr = &attr;
+        pthread_attr_setaffinity_np(pAttr, sizeof(cpuSet), &cpuSet);
+    }
 
-    if (0 != pthread_create(&Thread, nullptr, (void *(*)(void *))ThreadFunction, ThreadData))
+    if (0 != pthread_create(&Thread, pAttr, (void *(*)(void *))ThreadFunction, ThreadData))
     {
         Thread = 0;
         MOS_OS_ASSERTMESSAGE("Create thread failed.");
     }
 
+    if (pAttr)
+    {
+        pthread_attr_destroy(pAttr);
+    }
+
     return Thread;
 }
 
@@ -2552,6 +2936,10 @@ void MosUtilities::MosTraceEventInit()
         m_mosTraceFilter = {
                         m_mosTraceControlData->filter,
                         sizeof(m_mosTraceControlData->filter) / sizeof(uint64_t)};
+        // Event bitmap is read from shared memory on each check, so controller can change it at runtime.
+        m_mosTraceEventFilter = {
+                        m_mosTraceControlData->setting.eventDisable,
+                        sizeof(m_mosTraceControlData->setting.eventDisable) / sizeof(uint64_t)};
         m_mosTraceLevel = &m_mosTraceControlData->level;
     }
 
@@ -2561,6 +2949,13 @@ void MosUtilities::MosTraceEventInit()
         close(MosUtilitiesSpecificNext::m_mosTraceFd);
         MosUtilitiesSpecificNext::m_mosTraceFd = -1;
     }
+
+    // Shared memory trace ring avoids one syscall per event, and works without debugfs.
+    std::string valRing = MosParseEnvFromConfig("GFX_MEDIA_TRACE_RING");
+    if (!valRing.empty() && MosTraceRing::Open(static_cast<uint32_t>(strtoul(valRing.c_str(), nullptr, 0))))
+    {
+        return;
+    }
     MosUtilitiesSpecificNext::m_mosTraceFd = open(MosUtilitiesSpecificNext::m_mosTracePath, O_WRONLY);
     return;
 }
@@ -2569,6 +2964,7 @@ void MosUtilities::MosTraceEventClose()
 {
     m_mosTraceEnable.Reset();
     m_mosTraceFilter.Reset();
+    m_mosTraceEventFilter.Reset();
     m_mosTraceLevel.Reset();
     if (m_mosTraceControlData)
     {
@@ -2580,6 +2976,7 @@ void MosUtilities::MosTraceEventClose()
         close(MosUtilitiesSpecificNext::m_mosTraceFd);
         MosUtilitiesSpecificNext::m_mosTraceFd = -1;
     }
+    MosTraceRing::Close();
     MosUtilitiesSpecificNext::m_filterEnv = 0;
     MosUtilitiesSpecificNext::m_levelEnv  = {};
     return;
@@ -2598,12 +2995,12 @@ void MosUtilities::MosTraceEvent(
     const void       *pArg2,
     uint32_t         dwSize2)
 {
-    if (!m_mosTraceEnable)
+    if (!m_mosTraceEnable || !m_mosTraceEventFilter(usId))
     {
-        return; // skip if trace not enabled from share memory
+        return; // skip if trace or this event not enabled from share memory
     }
 
-    if (MosUtilitiesSpecificNext::m_mosTraceFd >= 0 &&
+    if (MosTraceOutputReady() &&
         TRACE_EVENT_MAX_SIZE > dwSize1 + dwSize2 + TRACE_EVENT_HEADER_SIZE)
     {
         uint8_t traceBuf[256];
@@ -2647,7 +3044,7 @@ void MosUtilities::MosTraceEvent(
                 MOS_SecureMemcpy(pTraceBuf+nLen, dwSize2, pArg2, dwSize2);
                 nLen += dwSize2;
             }
-            size_t writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, nLen);
+            MosTraceOutput(pTraceBuf, nLen);
             if (traceBuf != pTraceBuf)
             {
                 MOS_FreeMemory(pTraceBuf);
@@ -2670,7 +3067,7 @@ void MosUtilities::MosTraceEvent(
                 header[2] = 0;
                 header[3] = (uint32_t)num;
                 nLen += num*sizeof(void *);
-                size_t ret = write(MosUtilitiesSpecificNext::m_mosTraceFd, traceBuf, nLen);
+                MosTraceOutput(traceBuf, nLen);
             }
         }
 #endif
@@ -2700,10 +3097,9 @@ void MosUtilities::MosTraceDataDump(
     const void *pBuf,
     uint32_t    dwSize)
 {
-    if (MosUtilitiesSpecificNext::m_mosTraceFd >= 0 && pBuf && pcName)
+    if (MosTraceOutputReady() && pBuf && pcName)
     {
         uint8_t *pTraceBuf = (uint8_t *)MOS_AllocAndZeroMemory(TRACE_EVENT_MAX_SIZE);
-        size_t writeSize = 0;
 
         if (pTraceBuf)
         {
@@ -2718,7 +3114,7 @@ void MosUtilities::MosTraceDataDump(
             header[4] = flags;
             memcpy(&header[5], pcName, nLen);
             nLen += TRACE_EVENT_HEADER_SIZE + 8 + 1;
-            writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, nLen);
+            MosTraceOutput(pTraceBuf, nLen);
             // send dump data
             header[2] = EVENT_TYPE_INFO;
             const uint8_t *pData = static_cast<const uint8_t *>(pBuf);
@@ -2736,14 +3132,14 @@ void MosUtilities::MosTraceDataDump(
                 memcpy(pDst, &len, sizeof(len));
                 memcpy(pDst+sizeof(len), pData, size);
                 nLen = TRACE_EVENT_HEADER_SIZE + size + sizeof(len);
-                writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, nLen);
+                MosTraceOutput(pTraceBuf, nLen);
                 dwSize -= size;
                 pData += size;
             }
             // send dump end
             header[1] = EVENT_DATA_DUMP << 16;
             header[2] = EVENT_TYPE_END;
-            writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, TRACE_EVENT_HEADER_SIZE);
+            MosTraceOutput(pTraceBuf, TRACE_EVENT_HEADER_SIZE);
 
             MOS_FreeMemory(pTraceBuf);
         }
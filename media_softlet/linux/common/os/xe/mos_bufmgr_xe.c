@@ -253,6 +253,9 @@ typedef struct mos_xe_bufmgr_gem {
 #define EXEC_QUEUE_TIMESLICE_DEFAULT    -1
 #define EXEC_QUEUE_TIMESLICE_MAX        100000 //100ms
     int32_t exec_queue_timeslice;
+
+    /** CPU map statistics and prefault setting, protected by m_lock */
+    struct mos_bufmgr_map_tracker map_tracker = {};
 } mos_xe_bufmgr_gem;
 
 typedef struct mos_xe_exec_bo {
@@ -2035,6 +2038,7 @@ mos_bo_map_xe(struct mos_linux_bo *bo, int write_enable)
     int64_t timeout_nsec = INT64_MAX;
     uint32_t wait_flags = DRM_SYNCOBJ_WAIT_FLAGS_WAIT_ALL;
     uint32_t rw_flags = write_enable ? EXEC_OBJECT_WRITE_XE : EXEC_OBJECT_READ_XE;
+    uint64_t start_ns = mos_bufmgr_map_time_ns();
 
     ret =  __mos_gem_bo_wait_timeline_rendering_with_flags_xe(bo, timeout_nsec, wait_flags, rw_flags, nullptr);
     if (ret)
@@ -2049,6 +2053,7 @@ mos_bo_map_xe(struct mos_linux_bo *bo, int write_enable)
     }
 
     bufmgr_gem->m_lock.lock();
+    void *prev_virtual = bo_gem->mem_virtual;
     if (nullptr == bo_gem->mem_virtual)
     {
         struct drm_xe_gem_mmap_offset mmo;
@@ -2081,6 +2086,9 @@ mos_bo_map_xe(struct mos_linux_bo *bo, int write_enable)
 
     atomic_inc(&bo_gem->map_count);
 
+    mos_bufmgr_map_track(&bufmgr_gem->map_tracker,
+                         prev_virtual ? nullptr : bo_gem->mem_virtual,
+                         bo->size, start_ns);
     __mos_bo_mark_mmaps_incoherent_xe(bo);
     VG(VALGRIND_MAKE_MEM_DEFINED(bo_gem->mem_virtual, bo->size));
     bufmgr_gem->m_lock.unlock();
@@ -3471,6 +3479,31 @@ __mos_gem_cleanup_cache_bucket_xe(struct mos_xe_bufmgr_gem *bufmgr_gem)
     lab->max_cache_size = 0;
 }
 
+static void
+mos_set_map_prefault_xe(struct mos_bufmgr *bufmgr, uint64_t min_size)
+{
+    MOS_DRM_CHK_NULL_NO_STATUS_RETURN(bufmgr)
+    struct mos_xe_bufmgr_gem *bufmgr_gem = (struct mos_xe_bufmgr_gem *)bufmgr;
+
+    bufmgr_gem->m_lock.lock();
+    bufmgr_gem->map_tracker.prefault_min_size = min_size;
+    bufmgr_gem->m_lock.unlock();
+}
+
+static int
+mos_get_map_stats_xe(struct mos_bufmgr *bufmgr, struct mos_bufmgr_map_stats *stats)
+{
+    MOS_DRM_CHK_NULL_RETURN_VALUE(bufmgr, -EINVAL)
+    MOS_DRM_CHK_NULL_RETURN_VALUE(stats, -EINVAL)
+    struct mos_xe_bufmgr_gem *bufmgr_gem = (struct mos_xe_bufmgr_gem *)bufmgr;
+
+    bufmgr_gem->m_lock.lock();
+    *stats = bufmgr_gem->map_tracker.stats;
+    bufmgr_gem->m_lock.unlock();
+
+    return 0;
+}
+
 static void
 mos_gem_realloc_cache_bucket_xe(struct mos_bufmgr *bufmgr, uint8_t alloc_mode)
 {
@@ -3619,6 +3652,8 @@ mos_bufmgr_gem_init_xe(int fd, int batch_size)
     bufmgr_gem->bufmgr.bo_create_from_prime = mos_bo_create_from_prime_xe;
     bufmgr_gem->bufmgr.bo_export_to_prime = mos_bo_export_to_prime_xe;
     bufmgr_gem->bufmgr.realloc_cache = mos_gem_realloc_cache_bucket_xe;
+    bufmgr_gem->bufmgr.set_map_prefault = mos_set_map_prefault_xe;
+    bufmgr_gem->bufmgr.get_map_stats = mos_get_map_stats_xe;
     bufmgr_gem->bufmgr.get_devid = mos_get_devid_xe;
     bufmgr_gem->bufmgr.query_engines_count = mos_query_engines_count_xe;
     bufmgr_gem->bufmgr.query_engines = mos_query_engines_xe;
@@ -335,6 +335,7 @@ MOS_STATUS GpuContextSpecificNextXe::PatchCommandBuffer(
         }
 
 #if (_DEBUG || _RELEASE_INTERNAL)
+        if (MOS_TraceEventEnabled(EVENT_MOS_BATCH_SUBMIT))
         {
             uint32_t evtData[] = {alloc_bo->handle, currentPatch->uiWriteOperation, currentPatch->AllocationOffset};
             MOS_TraceEventExt(EVENT_MOS_BATCH_SUBMIT, EVENT_TYPE_INFO,